@@ -1,8 +1,17 @@
 #version 430
 
-uniform mat4 mvp;
+layout(std140) uniform Matrices {
+    mat4 projection;
+    mat4 view;
+};
+uniform mat4 model;
+
 layout(location = 0) in vec3 vp;
+layout(location = 4) in vec4 colorIn;
+
+out vec4 color;
 
 void main() {
-    gl_Position = mvp * vec4(vp, 1.0);
+    gl_Position = projection * view * model * vec4(vp, 1.0);
+    color = colorIn;
 }
@@ -3,14 +3,22 @@
 layout(binding = 0) uniform sampler2DArray textureUnit;
 
 uniform bool alphaTest;
-uniform vec4 modulateColor;
 uniform float globalTime;
 
 in vec3 uv;
+in vec4 modulateColor;
 out vec4 result;
 
+// Merged wall faces repeat the texture once per block, coordinates in (k, k + 1] map to the same tile. The tile is
+// sampled inside its outer texel centers so that linear filtering never blends in the opposite edge.
+vec3 tileCoordinates(in vec3 coordinates) {
+    vec2 halfTexel = 0.5 / vec2(textureSize(textureUnit, 0).xy);
+    vec2 tile = coordinates.xy - max(ceil(coordinates.xy) - 1.0, 0.0);
+    return vec3(clamp(tile, halfTexel, 1.0 - halfTexel), coordinates.z);
+}
+
 void main() {
-    vec4 color = texture(textureUnit, uv);
+    vec4 color = texture(textureUnit, tileCoordinates(uv));
     if (alphaTest && color.w < 1.0) {
         discard;
     }
@@ -4,21 +4,32 @@ const float waveHeight = 0.1;
 
 layout(location = 0) in vec3 vp;
 layout(location = 1) in vec2 uvIn;
-layout(location = 2) in float texIndexIn;
+layout(location = 2) in vec3 animationIn; // First texture, frames, seconds per frame
 layout(location = 3) in uint flagsIn;
+layout(location = 4) in vec4 modulateColorIn;
 
-uniform mat4 mvp;
+layout(std140) uniform Matrices {
+    mat4 projection;
+    mat4 view;
+};
+uniform mat4 model;
 uniform float globalTime;
 
 out vec3 uv;
+out vec4 modulateColor;
 
 vec3 waterWave(in vec3 position) {
     float displacement = sin(globalTime * 2.13 + 1.05 * position.x) * waveHeight;
     return vec3(position.x, position.y - waveHeight + displacement, position.z);
 }
 
+float animationFrame(in vec3 animation) {
+    return animation.y > 1.0 ? animation.x + mod(floor(globalTime / animation.z), animation.y) : animation.x;
+}
+
 void main() {
     vec3 pos = flagsIn == 1 ? waterWave(vp) : vp;
-    gl_Position = mvp * vec4(pos, 1.0);
-    uv = vec3(uvIn, texIndexIn);
+    gl_Position = projection * view * model * vec4(pos, 1.0);
+    uv = vec3(uvIn, animationFrame(animationIn));
+    modulateColor = modulateColorIn;
 }
\ No newline at end of file
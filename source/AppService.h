@@ -32,6 +32,7 @@
 #include "Sound.h"
 #include "input/Input.h"
 #include "input/PlayerControls.h"
+#include "JobSystem.h"
 #include "TextureManager.h"
 #include "Video.h"
 #include "script/ScriptManager.h"
@@ -47,12 +48,15 @@ namespace Duel6 {
         PlayerControlsManager &controlsManager;
         Sound &sound;
         Script::ScriptManager &scriptManager;
+        JobSystem &jobSystem;
 
     public:
         AppService(Font &font, Console &console, TextureManager &textureManager, Video &video, Input &input,
-                PlayerControlsManager &controlsManager, Sound &sound, Script::ScriptManager &scriptManager)
+                PlayerControlsManager &controlsManager, Sound &sound, Script::ScriptManager &scriptManager,
+                JobSystem &jobSystem)
                 : font(font), console(console), textureManager(textureManager), video(video), input(input),
-                  controlsManager(controlsManager), sound(sound), scriptManager(scriptManager) {}
+                  controlsManager(controlsManager), sound(sound), scriptManager(scriptManager),
+                  jobSystem(jobSystem) {}
 
         Font &getFont() {
             return font;
@@ -84,6 +88,10 @@ namespace Duel6 {
         Script::ScriptManager &getScriptManager() {
             return scriptManager;
         }
+
+        JobSystem &getJobSystem() {
+            return jobSystem;
+        }
     };
 }
 
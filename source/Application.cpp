@@ -36,6 +36,8 @@
 #include "ConsoleCommands.h"
 #include "Application.h"
 #include "FontException.h"
+#include "SimulationThread.h"
+#include "PhaseTimer.h"
 
 namespace Duel6 {
     namespace {
@@ -76,7 +78,8 @@ namespace Duel6 {
     Application::Application(Int32 argc, char **argv)
             : console(Console::ExpandFlag), input(console), controlsManager(input), sound(20, console),
               scriptContext(console, sound, gameSettings), scriptManager(scriptContext),
-              requestClose(false) {
+              jobSystem(JobSystem::getDefaultWorkerCount()), requestClose(false) {
+        PhaseTimer timer;
         if (SDL_Init(SDL_INIT_VIDEO) != 0) {
             D6_THROW(VideoException, Format("Unable to set graphics mode: {0}") << SDL_GetError());
         }
@@ -107,19 +110,23 @@ namespace Duel6 {
         console.printLine(Format("Lua version: {0}") << *luaVersion);
 #endif
 
+        console.printLine(Format("Job system workers: {0}") << jobSystem.getWorkerCount());
+
         Console::registerBasicCommands(console);
 
         console.printLine("\n===Video initialization==");
         video = std::make_unique<Video>(APP_NAME, APP_FILE_ICON, console);
-        textureManager = std::make_unique<TextureManager>(video->getRenderer());
+        textureManager = std::make_unique<TextureManager>(video->getRenderer(), jobSystem);
+        timer.endPhase("Video");
 
         console.printLine("\n===Font initialization===");
         font = std::make_unique<Font>(video->getRenderer());
         font->load(D6_FILE_TTF_FONT, console);
+        timer.endPhase("Font");
 
-        service = std::make_unique<AppService>(*font, console, *textureManager, *video, input, controlsManager, sound, scriptManager);
+        service = std::make_unique<AppService>(*font, console, *textureManager, *video, input, controlsManager, sound, scriptManager, jobSystem);
 
-        gameResources.load(console, sound, *textureManager);
+        gameResources.load(console, sound, *textureManager, timer);
 
         menu = std::make_unique<Menu>(*service);
         game = std::make_unique<Game>(*service, gameResources, gameSettings);
@@ -127,23 +134,24 @@ namespace Duel6 {
         menu->setGameReference(*game);
         game->setMenuReference(*menu);
 
-        FireList::initialize();
-
         for (Weapon weapon : Weapon::values()) {
             gameSettings.enableWeapon(weapon, true);
         }
 
         scriptManager.registerLoaders();
         menu->initialize();
+        timer.endPhase("Menu");
 
         // Execute config script and command line arguments
         console.printLine("\n===Config===");
-        ConsoleCommands::registerCommands(console, *service, *menu, gameSettings);
+        ConsoleCommands::registerCommands(console, *service, *menu, *game, gameSettings);
         console.exec(std::string("exec ") + D6_FILE_CONFIG);
 
         for (int i = 1; i < argc; i++) {
             console.exec(argv[i]);
         }
+        timer.endPhase("Config");
+        timer.print(console, "Startup times");
     }
 
     Application::~Application() {
@@ -265,7 +273,7 @@ namespace Duel6 {
         static Float64 accumulatedTime = 0.0f;
         Uint32 lastTime = curTime;
 
-        context.render();
+        context.render(Float32(accumulatedTime / updateTime));
         video->screenUpdate(console, *font);
 
         curTime = SDL_GetTicks();
@@ -278,13 +286,41 @@ namespace Duel6 {
         }
     }
 
+    void Application::runConcurrently(Context &context) {
+        SimulationThread simulation(context, updateTime);
+
+        // The context renders its published state without the lock while the simulation keeps running
+        while (simulation.isRunning() && !requestClose) {
+            {
+                std::lock_guard<std::mutex> lock(simulation.getMutex());
+                processEvents(context);
+                if (context.isClosed()) {
+                    break;
+                }
+            }
+
+            context.render(simulation.getInterpolation());
+            {
+                std::lock_guard<std::mutex> lock(simulation.getMutex());
+                video->renderConsole(console, *font);
+            }
+            video->swapBuffers();
+        }
+
+        simulation.stop();
+    }
+
     void Application::run() {
         Context::push(*menu);
 
         while (Context::exists() && !requestClose) {
             Context &context = Context::getCurrent();
-            processEvents(context);
-            syncUpdateAndRender(context);
+            if (context.isSimulatedConcurrently()) {
+                runConcurrently(context);
+            } else {
+                processEvents(context);
+                syncUpdateAndRender(context);
+            }
 
             if (context.isClosed()) {
                 Context::pop();
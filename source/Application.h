@@ -50,6 +50,7 @@ namespace Duel6 {
         GameResources gameResources;
         Script::ScriptContext scriptContext;
         Script::ScriptManager scriptManager;
+        JobSystem jobSystem;
         std::unique_ptr<Menu> menu;
         std::unique_ptr<Game> game;
         std::unique_ptr<AppService> service;
@@ -78,6 +79,8 @@ namespace Duel6 {
         void joyDeviceAddedEvent(Context & context, const JoyDeviceAddedEvent & event);
         void joyDeviceRemovedEvent(Context & context, const JoyDeviceRemovedEvent & event);
         void syncUpdateAndRender(Context &context);
+
+        void runConcurrently(Context &context);
     };
 }
 
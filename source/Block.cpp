@@ -29,6 +29,7 @@
 #include <array>
 #include "Block.h"
 #include "DataException.h"
+#include "Format.h"
 #include "json/JsonParser.h"
 
 namespace Duel6 {
@@ -58,15 +59,20 @@ namespace Duel6 {
     Block::Meta Block::loadMeta(const std::string &path) {
         Block::Meta meta;
         Json::Parser parser;
-        Json::Value root = parser.parse(path);
+        Json::Document document = parser.parseDocument(path);
+        Json::Node root = document.getRoot();
 
         for (Size i = 0; i < root.getLength(); i++) {
-            Json::Value block = root.get(i);
+            Json::Node block = root.get(i);
             Block::Type type = determineType(block.get("kind").asString());
-            Json::Value animations = block.get("animations");
+            Json::Span<Int32> animations = block.get("animations").asIntArray();
             std::vector<Int32> textures;
-            for (Size j = 0; j < animations.getLength(); j++) {
-                textures.push_back(animations.get(j).asInt());
+            for (Size j = 0; j < animations.size(); j++) {
+                textures.push_back(animations[j]);
+                // Renderers derive the texture of a frame from the first one
+                if (textures[j] != textures[0] + Int32(j)) {
+                    D6_THROW(DataException, Format("Animation of block {0} does not use consecutive textures") << i);
+                }
             }
             meta.push_back(Block(meta.size(), type, std::move(textures)));
         }
@@ -84,6 +84,7 @@ namespace Duel6 {
             return Water::NONE;
         }
 
+        /** Animation frames use consecutive textures */
         const std::vector<Int32> &getTextures() const {
             return textures;
         }
@@ -32,10 +32,16 @@
 #include "collision/Collision.h"
 
 namespace Duel6 {
-    BonusList::BonusList(const GameSettings &settings, const GameResources &resources, World &world)
-            : settings(settings), texture(resources.getBonusTextures()), world(world) {}
+    BonusList::BonusList(const GameSettings &settings, World &world)
+            : settings(settings), world(world) {}
 
-    void BonusList::render(Renderer &renderer) const {
+    void BonusList::snapshot(std::vector<Bonus> &bonuses, std::vector<LyingWeapon> &weapons) const {
+        bonuses.assign(this->bonuses.begin(), this->bonuses.end());
+        weapons.assign(this->weapons.begin(), this->weapons.end());
+    }
+
+    void BonusList::render(Renderer &renderer, Texture texture, const std::vector<Bonus> &bonuses,
+                           const std::vector<LyingWeapon> &weapons) {
         for (const Bonus &bonus : bonuses) {
             bonus.render(renderer, texture);
         }
@@ -29,6 +29,7 @@
 #define DUEL6_BONUSLIST_H
 
 #include <list>
+#include <vector>
 #include "Type.h"
 #include "Bonus.h"
 #include "Player.h"
@@ -42,7 +43,6 @@ namespace Duel6 {
     class BonusList {
     private:
         const GameSettings &settings;
-        Texture texture;
         World &world;
         std::list<Bonus> bonuses;
         std::list<LyingWeapon> weapons;
@@ -55,13 +55,16 @@ namespace Duel6 {
         bool isValidPosition(const Int32 x, const Int32 y, bool weapon);
 
     public:
-        BonusList(const GameSettings &settings, const GameResources &resources, World &world);
+        BonusList(const GameSettings &settings, World &world);
 
         void update(Float32 elapsedTime);
 
         void addRandomBonus();
 
-        void render(Renderer &renderer) const;
+        void snapshot(std::vector<Bonus> &bonuses, std::vector<LyingWeapon> &weapons) const;
+
+        static void render(Renderer &renderer, Texture texture, const std::vector<Bonus> &bonuses,
+                           const std::vector<LyingWeapon> &weapons);
 
         void addPlayerGun(Player &player, const CollidingEntity &playerColliders);
 
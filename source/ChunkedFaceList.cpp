@@ -0,0 +1,149 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <limits>
+#include "ChunkedFaceList.h"
+
+namespace Duel6 {
+    ChunkedFaceList::ChunkedFaceList()
+            : levelWidth(0), width(0), height(0), margin(0) {}
+
+    void ChunkedFaceList::resize(Int32 levelWidth, Int32 levelHeight, Float32 margin) {
+        this->levelWidth = levelWidth;
+        width = (levelWidth + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        height = (levelHeight + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        this->margin = margin;
+        chunks = std::vector<Chunk>(Size(width * height));
+        cellFaces = std::vector<std::vector<Size>>(Size(levelWidth * levelHeight));
+    }
+
+    void ChunkedFaceList::clear() {
+        for (Chunk &chunk : chunks) {
+            chunk.faces.clear();
+            chunk.owners.clear();
+        }
+        for (std::vector<Size> &faces : cellFaces) {
+            faces.clear();
+        }
+    }
+
+    void ChunkedFaceList::reserve(Size facesPerCell) {
+        for (Chunk &chunk : chunks) {
+            chunk.faces.reserve(facesPerCell * CHUNK_SIZE * CHUNK_SIZE);
+        }
+    }
+
+    void ChunkedFaceList::setCellFaces(Int32 x, Int32 y, const FaceList &faces) {
+        Chunk &chunk = getChunkData(x, y);
+        Int32 cell = y * levelWidth + x;
+        std::vector<Size> &ownFaces = cellFaces[cell];
+        chunk.owners.resize(chunk.faces.getFaces().size(), -1);
+
+        // Removing from the back keeps the remaining indexes of the cell valid
+        std::sort(ownFaces.begin(), ownFaces.end());
+        while (!ownFaces.empty()) {
+            Size index = ownFaces.back();
+            ownFaces.pop_back();
+            removeFace(chunk, index);
+        }
+
+        const Vertex *vertex = faces.getVertexes().data();
+        for (const Face &face : faces.getFaces()) {
+            ownFaces.push_back(chunk.faces.getFaces().size());
+            chunk.owners.push_back(cell);
+            chunk.faces.addFace(face);
+            for (Size i = 0; i < 4; i++) {
+                chunk.faces.addVertex(vertex[i]);
+            }
+            vertex += 4;
+        }
+        extendBounds(chunk, faces.getVertexes().data(), faces.getVertexes().size());
+    }
+
+    void ChunkedFaceList::removeFace(Chunk &chunk, Size index) {
+        Size last = chunk.owners.size() - 1;
+        Int32 owner = chunk.owners[last];
+        if (index != last && owner >= 0) {
+            std::vector<Size> &ownerFaces = cellFaces[owner];
+            std::replace(ownerFaces.begin(), ownerFaces.end(), last, index);
+        }
+        chunk.owners[index] = owner;
+        chunk.owners.pop_back();
+        chunk.faces.removeFace(index);
+    }
+
+    void ChunkedFaceList::build(Renderer &renderer, Float32 animationSpeed) {
+        for (Chunk &chunk : chunks) {
+            buildChunk(chunk, renderer, animationSpeed);
+        }
+    }
+
+    void ChunkedFaceList::buildChunk(Chunk &chunk, Renderer &renderer, Float32 animationSpeed) {
+        chunk.min = Vector(std::numeric_limits<Float32>::max(), std::numeric_limits<Float32>::max(),
+                           std::numeric_limits<Float32>::max());
+        chunk.max = Vector(std::numeric_limits<Float32>::lowest(), std::numeric_limits<Float32>::lowest(),
+                           std::numeric_limits<Float32>::lowest());
+        extendBounds(chunk, chunk.faces.getVertexes().data(), chunk.faces.getVertexes().size());
+        chunk.faces.build(renderer, animationSpeed);
+    }
+
+    void ChunkedFaceList::extendBounds(Chunk &chunk, const Vertex *vertexes, Size count) {
+        for (Size i = 0; i < count; i++) {
+            const Vertex &vertex = vertexes[i];
+            chunk.min = Vector(std::min(chunk.min.x, vertex.x - margin), std::min(chunk.min.y, vertex.y - margin),
+                               std::min(chunk.min.z, vertex.z - margin));
+            chunk.max = Vector(std::max(chunk.max.x, vertex.x + margin), std::max(chunk.max.y, vertex.y + margin),
+                               std::max(chunk.max.z, vertex.z + margin));
+        }
+    }
+
+    Size ChunkedFaceList::render(Texture texture, bool masked, const Frustum &frustum) const {
+        Size rendered = 0;
+        for (const Chunk &chunk : chunks) {
+            if (!chunk.faces.getFaces().empty() && frustum.isVisible(chunk.min, chunk.max)) {
+                chunk.faces.render(texture, masked);
+                rendered++;
+            }
+        }
+        return rendered;
+    }
+
+    void ChunkedFaceList::setAnimationTime(Float32 time) {
+        for (Chunk &chunk : chunks) {
+            chunk.faces.setAnimationTime(time);
+        }
+    }
+
+    Size ChunkedFaceList::getFaceCount() const {
+        Size count = 0;
+        for (const Chunk &chunk : chunks) {
+            count += chunk.faces.getFaces().size();
+        }
+        return count;
+    }
+}
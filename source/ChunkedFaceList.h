@@ -0,0 +1,107 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef DUEL6_CHUNKEDFACELIST_H
+#define DUEL6_CHUNKEDFACELIST_H
+
+#include <vector>
+#include "FaceList.h"
+#include "math/Frustum.h"
+
+namespace Duel6 {
+    /** Faces of a level split into square chunks of cells, each chunk has its own buffer and bounding box */
+    class ChunkedFaceList {
+    public:
+        static constexpr Int32 CHUNK_SIZE = 8;
+
+    private:
+        struct Chunk {
+            FaceList faces;
+            // Cell of every face added by setCellFaces, -1 for other faces
+            std::vector<Int32> owners;
+            Vector min;
+            Vector max;
+        };
+
+        Int32 levelWidth;
+        Int32 width;
+        Int32 height;
+        std::vector<Chunk> chunks;
+        std::vector<std::vector<Size>> cellFaces;
+        Float32 margin;
+
+    public:
+        ChunkedFaceList();
+
+        /** Splits a level of the given size, the margin enlarges bounding boxes of faces moved by renderers */
+        void resize(Int32 levelWidth, Int32 levelHeight, Float32 margin);
+
+        /** The chunk containing the cell */
+        FaceList &getChunk(Int32 x, Int32 y) {
+            return getChunkData(x, y).faces;
+        }
+
+        /** First cell coordinate after the chunk containing the given one */
+        static Int32 getChunkEnd(Int32 cell) {
+            return (cell / CHUNK_SIZE + 1) * CHUNK_SIZE;
+        }
+
+        void clear();
+
+        /** Reserves buffer space in every chunk so that each cell can get the given number of faces */
+        void reserve(Size facesPerCell);
+
+        /** Replaces the faces of the cell set by the previous call, other faces of the chunk keep their place */
+        void setCellFaces(Int32 x, Int32 y, const FaceList &faces);
+
+        void build(Renderer &renderer, Float32 animationSpeed);
+
+        /** Renders chunks intersecting the frustum, returns their number */
+        Size render(Texture texture, bool masked, const Frustum &frustum) const;
+
+        void setAnimationTime(Float32 time);
+
+        Size getFaceCount() const;
+
+        Size getChunkCount() const {
+            return chunks.size();
+        }
+
+    private:
+        Chunk &getChunkData(Int32 x, Int32 y) {
+            return chunks[(y / CHUNK_SIZE) * width + x / CHUNK_SIZE];
+        }
+
+        void buildChunk(Chunk &chunk, Renderer &renderer, Float32 animationSpeed);
+
+        void removeFace(Chunk &chunk, Size index);
+
+        void extendBounds(Chunk &chunk, const Vertex *vertexes, Size count);
+    };
+}
+
+#endif
@@ -0,0 +1,168 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <vector>
+#include "CompiledLevel.h"
+#include "DataException.h"
+#include "File.h"
+#include "Format.h"
+#include "json/JsonParser.h"
+
+namespace Duel6 {
+    namespace {
+        const char LEVEL_MAGIC[4] = {'D', '6', 'L', 0};
+        const char LEVEL_EXTENSION[] = ".d6l";
+    }
+
+    CompiledLevel::CompiledLevel(const std::string &path)
+            : file(path), header(reinterpret_cast<const Header *>(file.getData())), mirroredBlocks(nullptr) {
+        if (file.getSize() < sizeof(Header) || !std::equal(LEVEL_MAGIC, LEVEL_MAGIC + 4, header->magic)) {
+            D6_THROW(DataException, Format("Invalid compiled level {0}") << path);
+        }
+        if (header->version != VERSION) {
+            D6_THROW(DataException, Format("Compiled level {0} has version {1}, expected {2}")
+                    << path << header->version << VERSION);
+        }
+
+        Size gridBytes = Size(header->width) * header->height * sizeof(Uint16);
+        Size expectedSize = sizeof(Header) + header->elevators * sizeof(Elevator) +
+                            header->controlPoints * sizeof(ControlPoint) +
+                            (header->mirrored ? 2 : 1) * gridBytes + header->backgroundLength;
+        if (file.getSize() != expectedSize) {
+            D6_THROW(DataException, Format("Compiled level {0} has {1} bytes, expected {2}")
+                    << path << file.getSize() << expectedSize);
+        }
+
+        const Uint8 *data = file.getData() + sizeof(Header);
+        elevators = reinterpret_cast<const Elevator *>(data);
+        data += header->elevators * sizeof(Elevator);
+        controlPoints = reinterpret_cast<const ControlPoint *>(data);
+        data += header->controlPoints * sizeof(ControlPoint);
+        blocks = reinterpret_cast<const Uint16 *>(data);
+        data += gridBytes;
+        if (header->mirrored) {
+            mirroredBlocks = reinterpret_cast<const Uint16 *>(data);
+            data += gridBytes;
+        }
+        background = reinterpret_cast<const char *>(data);
+
+        for (Size i = 0; i < header->elevators; i++) {
+            if (Size(elevators[i].firstPoint) + elevators[i].points > header->controlPoints) {
+                D6_THROW(DataException, Format("Invalid elevator {0} in compiled level {1}") << i << path);
+            }
+        }
+    }
+
+    std::string CompiledLevel::getPath(const std::string &levelPath) {
+        Size extension = levelPath.rfind('.');
+        Size directory = levelPath.find_last_of("/\\");
+        if (extension == std::string::npos || (directory != std::string::npos && extension < directory)) {
+            return levelPath + LEVEL_EXTENSION;
+        }
+        return levelPath.substr(0, extension) + LEVEL_EXTENSION;
+    }
+
+    bool CompiledLevel::isAvailable(const std::string &levelPath) {
+        std::string path = getPath(levelPath);
+        Int64 modificationTime = File::getModificationTime(path);
+        if (modificationTime == 0 || modificationTime < File::getModificationTime(levelPath) ||
+            File::getSize(path) < sizeof(Header)) {
+            return false;
+        }
+
+        // Files written by an older converter are ignored until they are converted again
+        Header fileHeader;
+        File(path, File::Mode::Binary, File::Access::Read).read(&fileHeader, sizeof(Header), 1);
+        return std::equal(LEVEL_MAGIC, LEVEL_MAGIC + 4, fileHeader.magic) && fileHeader.version == VERSION;
+    }
+
+    void CompiledLevel::compile(const std::string &levelPath, const std::string &path, bool mirror, Size blockCount) {
+        Json::Parser parser;
+        Json::Document document = parser.parseDocument(levelPath);
+        Json::Node root = document.getRoot();
+
+        Int32 width = root.get("width").asInt();
+        Int32 height = root.get("height").asInt();
+        std::string background = root.has("background") ? root.get("background").asString() : "";
+        if (width <= 0 || height <= 0) {
+            D6_THROW(DataException, Format("Level {0} has invalid size {1}x{2}") << levelPath << width << height);
+        }
+
+        Json::Span<Int32> levelBlocks = root.get("blocks").asIntArray();
+        if (levelBlocks.size() > Size(width * height)) {
+            D6_THROW(DataException, Format("Level {0} has {1} blocks, expected {2}")
+                    << levelPath << levelBlocks.size() << (width * height));
+        }
+        for (Size i = 0; i < levelBlocks.size(); i++) {
+            if (levelBlocks[i] < 0 || Size(levelBlocks[i]) >= blockCount) {
+                D6_THROW(DataException, Format("Level {0} has unknown block {1} at index {2}")
+                        << levelPath << levelBlocks[i] << i);
+            }
+        }
+        std::vector<Uint16> blocks(width * height, 0);
+        std::copy(levelBlocks.begin(), levelBlocks.end(), blocks.begin());
+
+        std::vector<Elevator> elevators;
+        std::vector<ControlPoint> controlPoints;
+        Json::Node definitions = root.get("elevators");
+        for (Size i = 0; i < definitions.getLength(); i++) {
+            Json::Node definition = definitions.get(i);
+            Json::Node points = definition.get("controlPoints");
+            bool circular = definition.has("circular") && definition.get("circular").asBoolean();
+            elevators.push_back({circular ? 1u : 0u, Uint32(controlPoints.size()), Uint32(points.getLength())});
+            for (Size j = 0; j < points.getLength(); j++) {
+                Json::Node point = points.get(j);
+                Int32 wait = point.has("wait") ? point.get("wait").asInt() : 0;
+                controlPoints.push_back({point.get("x").asInt(), point.get("y").asInt(), wait});
+            }
+        }
+
+        Header header;
+        std::copy(LEVEL_MAGIC, LEVEL_MAGIC + 4, header.magic);
+        header.version = VERSION;
+        header.width = Uint32(width);
+        header.height = Uint32(height);
+        header.mirrored = mirror ? 1 : 0;
+        header.elevators = Uint32(elevators.size());
+        header.controlPoints = Uint32(controlPoints.size());
+        header.backgroundLength = Uint32(background.size());
+
+        File file(path, File::Mode::Binary, File::Access::Write);
+        file.write(&header, sizeof(Header), 1);
+        file.write(elevators.data(), sizeof(Elevator), elevators.size());
+        file.write(controlPoints.data(), sizeof(ControlPoint), controlPoints.size());
+        file.write(blocks.data(), sizeof(Uint16), blocks.size());
+        if (mirror) {
+            for (Int32 y = 0; y < height; y++) {
+                std::reverse(blocks.begin() + y * width, blocks.begin() + (y + 1) * width);
+            }
+            file.write(blocks.data(), sizeof(Uint16), blocks.size());
+        }
+        file.write(background.data(), 1, background.size());
+    }
+}
@@ -0,0 +1,125 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef DUEL6_COMPILEDLEVEL_H
+#define DUEL6_COMPILEDLEVEL_H
+
+#include <string>
+#include "MappedFile.h"
+#include "Type.h"
+
+namespace Duel6 {
+    /**
+     * Level converted from JSON to a binary file which is mapped into memory and used without parsing.
+     * Layout in native byte order: header, elevators, control points, block grid, optional mirrored block grid
+     * and the background name.
+     */
+    class CompiledLevel {
+    public:
+        static const Uint32 VERSION = 1;
+
+        struct ControlPoint {
+            Int32 x;
+            Int32 y;
+            Int32 wait;
+        };
+
+        struct Elevator {
+            Uint32 circular;
+            Uint32 firstPoint;
+            Uint32 points;
+        };
+
+    private:
+        struct Header {
+            char magic[4];
+            Uint32 version;
+            Uint32 width;
+            Uint32 height;
+            Uint32 mirrored;
+            Uint32 elevators;
+            Uint32 controlPoints;
+            Uint32 backgroundLength;
+        };
+
+    private:
+        MappedFile file;
+        const Header *header;
+        const Elevator *elevators;
+        const ControlPoint *controlPoints;
+        const Uint16 *blocks;
+        const Uint16 *mirroredBlocks;
+        const char *background;
+
+    public:
+        explicit CompiledLevel(const std::string &path);
+
+        Int32 getWidth() const {
+            return Int32(header->width);
+        }
+
+        Int32 getHeight() const {
+            return Int32(header->height);
+        }
+
+        std::string getBackground() const {
+            return std::string(background, header->backgroundLength);
+        }
+
+        const Uint16 *getBlocks() const {
+            return blocks;
+        }
+
+        /** Blocks of the level flipped horizontally, nullptr if the file does not contain them */
+        const Uint16 *getMirroredBlocks() const {
+            return mirroredBlocks;
+        }
+
+        Size getElevatorCount() const {
+            return header->elevators;
+        }
+
+        const Elevator &getElevator(Size index) const {
+            return elevators[index];
+        }
+
+        const ControlPoint &getControlPoint(Size index) const {
+            return controlPoints[index];
+        }
+
+        /** Path of the binary file belonging to a JSON level */
+        static std::string getPath(const std::string &levelPath);
+
+        /** Whether the binary file of a JSON level exists, is not older than the level and has the current version */
+        static bool isAvailable(const std::string &levelPath);
+
+        /** Blocks of the level must be indexes below blockCount, the number of blocks in the block meta data */
+        static void compile(const std::string &levelPath, const std::string &path, bool mirror, Size blockCount);
+    };
+}
+
+#endif
@@ -275,7 +275,34 @@ namespace Duel6 {
         }
     }
 
-    void ConsoleCommands::registerCommands(Console &console, AppService &appService, Menu &menu,
+    void ConsoleCommands::seed(Console &console, const Console::Arguments &args, GameSettings &gameSettings) {
+        if (args.length() == 2) {
+            gameSettings.setDeterministic(args.get(1) != "off");
+            if (gameSettings.isDeterministic()) {
+                gameSettings.setSeed(Uint32(std::stoul(args.get(1))));
+            }
+        }
+
+        if (gameSettings.isDeterministic()) {
+            console.printLine(Format("Seed: {0}") << gameSettings.getSeed());
+        } else {
+            console.printLine("Seed [<number>/off]: off");
+        }
+    }
+
+    void ConsoleCommands::saveReplay(Console &console, const Console::Arguments &args, const Game &game) {
+        if (args.length() == 2) {
+            const Replay &replay = game.getReplay();
+            replay.save(args.get(1));
+            console.printLine(Format("Replay of {0} rounds and {1} ticks saved to {2}") << replay.getRounds().size()
+                                                                                        << replay.getTicks()
+                                                                                        << args.get(1));
+        } else {
+            console.printLine("Usage: save_replay <file>");
+        }
+    }
+
+    void ConsoleCommands::registerCommands(Console &console, AppService &appService, Menu &menu, Game &game,
                                            GameSettings &gameSettings) {
         // Set some console functions
         console.setLast(15);
@@ -328,5 +355,11 @@ namespace Duel6 {
         console.registerCommand("start_ammo_range", [&gameSettings](Console &con, const Console::Arguments &args) {
             ammoRange(con, args, gameSettings);
         });
+        console.registerCommand("seed", [&gameSettings](Console &con, const Console::Arguments &args) {
+            seed(con, args, gameSettings);
+        });
+        console.registerCommand("save_replay", [&game](Console &con, const Console::Arguments &args) {
+            saveReplay(con, args, game);
+        });
     }
 }
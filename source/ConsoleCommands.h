@@ -70,8 +70,13 @@ namespace Duel6 {
 
         static void runMap(Console &console, const Console::Arguments &args, Menu &menu);
 
+        static void seed(Console &console, const Console::Arguments &args, GameSettings &gameSettings);
+
+        static void saveReplay(Console &console, const Console::Arguments &args, const Game &game);
+
     public:
-        static void registerCommands(Console &console, AppService &appService, Menu &menu, GameSettings &gameSettings);
+        static void registerCommands(Console &console, AppService &appService, Menu &menu, Game &game,
+                                     GameSettings &gameSettings);
     };
 }
 
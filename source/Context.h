@@ -74,7 +74,13 @@ namespace Duel6 {
 
         virtual void update(Float32 elapsedTime) = 0;
 
-        virtual void render() const = 0;
+        /** Interpolation is the fraction of the next update that has already elapsed, between 0 and 1 */
+        virtual void render(Float32 interpolation) const = 0;
+
+        /** Contexts that render only published snapshots of their state are updated on a separate thread */
+        virtual bool isSimulatedConcurrently() const {
+            return false;
+        }
 
         virtual bool isClosed() const final {
             return closed;
@@ -78,7 +78,7 @@ namespace Duel6 {
 
         void update(Float32 elapsedTime);
 
-        void render(Renderer &renderer, Texture texture) const;
+        static void render(Renderer &renderer, Texture texture, const Vector &position);
 
         const Vector &getPosition() const {
             return position;
@@ -27,49 +27,86 @@
 
 #include "Player.h"
 #include "ElevatorList.h"
+#include "CompiledLevel.h"
 #include "json/JsonParser.h"
 
 namespace Duel6 {
-    ElevatorList::ElevatorList(Texture texture)
-            : texture(texture) {}
-
     void ElevatorList::add(Elevator &elevator) {
         elevators.push_back(elevator);
         elevators.back().start();
     }
 
     void ElevatorList::load(const std::string &path, bool mirror) {
+        if (CompiledLevel::isAvailable(path)) {
+            loadCompiled(CompiledLevel::getPath(path), mirror);
+        } else {
+            loadJson(path, mirror);
+        }
+    }
+
+    void ElevatorList::loadJson(const std::string &path, bool mirror) {
         Json::Parser parser;
-        Json::Value root = parser.parse(path);
+        Json::Document document = parser.parseDocument(path);
+        Json::Node root = document.getRoot();
 
         Int32 width = root.get("width").asInt();
         Int32 height = root.get("height").asInt();
 
-        Size elevators = root.get("elevators").getLength();
-        for (Size i = 0; i < elevators; i++) {
-            Json::Value definition = root.get("elevators").get(i);
-            bool circular = definition.getOrDefault("circular", Json::Value::makeBoolean(false)).asBoolean();
+        Json::Node definitions = root.get("elevators");
+        for (Size i = 0; i < definitions.getLength(); i++) {
+            Json::Node definition = definitions.get(i);
+            bool circular = definition.has("circular") && definition.get("circular").asBoolean();
             Elevator elevator(circular);
-            Json::Value points = definition.get("controlPoints");
+            Json::Node points = definition.get("controlPoints");
             for (Size j = 0; j < points.getLength(); j++) {
-                Int32 x = points.get(j).get("x").asInt();
-                Int32 y = points.get(j).get("y").asInt();
-                Int32 wait = points.get(j).getOrDefault("wait", Json::Value::makeNumber(0)).asInt();
+                Json::Node point = points.get(j);
+                Int32 x = point.get("x").asInt();
+                Int32 y = point.get("y").asInt();
+                Int32 wait = point.has("wait") ? point.get("wait").asInt() : 0;
                 elevator.addControlPoint(Elevator::ControlPoint(mirror ? width - 1 - x : x, height - y, wait));
             }
             add(elevator);
         }
     }
 
+    void ElevatorList::loadCompiled(const std::string &path, bool mirror) {
+        CompiledLevel level(path);
+        Int32 width = level.getWidth();
+        Int32 height = level.getHeight();
+
+        for (Size i = 0; i < level.getElevatorCount(); i++) {
+            const CompiledLevel::Elevator &definition = level.getElevator(i);
+            Elevator elevator(definition.circular != 0);
+            for (Size j = 0; j < definition.points; j++) {
+                const CompiledLevel::ControlPoint &point = level.getControlPoint(definition.firstPoint + j);
+                Int32 x = point.x;
+                elevator.addControlPoint(
+                        Elevator::ControlPoint(mirror ? width - 1 - x : x, height - point.y, point.wait));
+            }
+            add(elevator);
+        }
+    }
+
     void ElevatorList::update(Float32 elapsedTime) {
         for (Elevator &elevator : elevators) {
             elevator.update(elapsedTime);
         }
     }
 
-    void ElevatorList::render(Renderer &renderer) const {
+    void ElevatorList::snapshot(std::vector<Vector> &positions, std::vector<Vector> &previousPositions) {
+        positions.clear();
         for (const Elevator &elevator : elevators) {
-            elevator.render(renderer, texture);
+            positions.push_back(elevator.getPosition());
+        }
+        previousPositions = snapshotPositions.size() == positions.size() ? snapshotPositions : positions;
+        snapshotPositions = positions;
+    }
+
+    void ElevatorList::render(Renderer &renderer, Texture texture, const std::vector<Vector> &positions,
+                              const std::vector<Vector> &previousPositions, Float32 interpolation) {
+        for (Size i = 0; i < positions.size(); i++) {
+            const Vector &previous = previousPositions[i];
+            Elevator::render(renderer, texture, previous + (positions[i] - previous) * interpolation);
         }
     }
 
@@ -39,21 +39,28 @@ namespace Duel6 {
 
     class ElevatorList {
     private:
-        Texture texture;
         std::vector<Elevator> elevators;
+        std::vector<Vector> snapshotPositions;
 
     public:
-        ElevatorList(Texture texture);
-
         void load(const std::string &path, bool mirror);
 
         void add(Elevator &elevator);
 
         void update(Float32 elapsedTime);
 
-        void render(Renderer &renderer) const;
+        /** Positions in the snapshot become the previous positions of the next one */
+        void snapshot(std::vector<Vector> &positions, std::vector<Vector> &previousPositions);
+
+        static void render(Renderer &renderer, Texture texture, const std::vector<Vector> &positions,
+                           const std::vector<Vector> &previousPositions, Float32 interpolation);
 
         const Elevator *checkCollider(CollidingEntity & collider, Float32 speedFactor);
+
+    private:
+        void loadJson(const std::string &path, bool mirror);
+
+        void loadCompiled(const std::string &path, bool mirror);
     };
 }
 
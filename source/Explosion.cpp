@@ -25,26 +25,24 @@
 * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <algorithm>
 #include "Explosion.h"
 
 namespace Duel6 {
-    ExplosionList::ExplosionList(const GameResources &resources, Float32 speed)
-            : textures(resources.getExplosionTextures()), speed(speed) {
+    ExplosionList::ExplosionList(Float32 speed)
+            : speed(speed) {
     }
 
     void ExplosionList::update(Float32 elapsedTime) {
-        auto explIter = explosions.begin();
-        while (explIter != explosions.end()) {
-            explIter->now += speed * elapsedTime;
-            if (explIter->now > explIter->max) {
-                explIter = explosions.erase(explIter);
-            } else {
-                ++explIter;
-            }
+        for (Explosion &explosion : explosions) {
+            explosion.now += speed * elapsedTime;
         }
+        explosions.erase(std::remove_if(explosions.begin(), explosions.end(), [](const Explosion &explosion) {
+            return explosion.now > explosion.max;
+        }), explosions.end());
     }
 
-    void ExplosionList::render(Renderer &renderer) const {
+    void ExplosionList::render(Renderer &renderer, Texture textures, const std::vector<Explosion> &explosions) {
         renderer.enableDepthTest(false);
 
         for (const Explosion &explosion : explosions) {
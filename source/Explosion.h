@@ -28,7 +28,7 @@
 #ifndef DUEL6_EXPLOSION_H
 #define DUEL6_EXPLOSION_H
 
-#include <list>
+#include <vector>
 #include "Type.h"
 #include "Color.h"
 #include "TextureManager.h"
@@ -45,16 +45,19 @@ namespace Duel6 {
 
     class ExplosionList {
     private:
-        Texture textures;
-        std::list<Explosion> explosions;
+        std::vector<Explosion> explosions;
         Float32 speed;
 
     public:
-        ExplosionList(const GameResources &resources, Float32 speed);
+        explicit ExplosionList(Float32 speed);
 
         void update(Float32 elapsedTime);
 
-        void render(Renderer &renderer) const;
+        const std::vector<Explosion> &getExplosions() const {
+            return explosions;
+        }
+
+        static void render(Renderer &renderer, Texture textures, const std::vector<Explosion> &explosions);
 
         void add(const Vector &centre, Float32 startSize, Float32 maxSize, const Color &color);
     };
@@ -35,29 +35,28 @@ namespace Duel6 {
     class Face {
     private:
         const Block *block;
-        Size currentAnimationFrame;
         bool hidden;
 
     public:
         explicit Face(const Block &block)
-                : block(&block), currentAnimationFrame(0), hidden(false) {
+                : block(&block), hidden(false) {
         }
 
         const Block &getBlock() const {
             return *block;
         }
 
-        Uint32 getCurrentTexture() const {
-            return hidden ? 0 : block->getTextures()[currentAnimationFrame];
+        /** Texture of the given animation frame, the animation repeats. */
+        Uint32 getTexture(Size animationFrame) const {
+            return getFirstTexture() + Uint32(animationFrame % getAnimationFrames());
         }
 
-        /** Next animation frame. */
-        Face &nextFrame() {
-            if (++currentAnimationFrame >= block->getAnimationFrames()) {
-                currentAnimationFrame = 0;
-            }
+        Uint32 getFirstTexture() const {
+            return hidden ? 0 : Uint32(block->getTextures()[0]);
+        }
 
-            return *this;
+        Size getAnimationFrames() const {
+            return hidden ? 1 : block->getAnimationFrames();
         }
 
         /** Makes the face disappear. */
@@ -32,15 +32,46 @@ namespace Duel6 {
     FaceList::~FaceList() {
     }
 
-    void FaceList::build(Renderer &renderer) {
-        if (!faces.empty()) {
-            buffer = renderer.makeBuffer(*this);
-        } else {
-            buffer = nullptr;
+    void FaceList::build(Renderer &renderer, Float32 animationSpeed) {
+        this->renderer = &renderer;
+        this->animationSpeed = animationSpeed;
+        rebuildBuffer = true;
+    }
+
+    void FaceList::removeFace(Size index) {
+        Size last = faces.size() - 1;
+        if (index != last) {
+            faces[index] = faces[last];
+            std::copy_n(vertexes.begin() + 4 * last, 4, vertexes.begin() + 4 * index);
+            dirtyFirst = std::min(dirtyFirst, index);
         }
+        faces.pop_back();
+        vertexes.erase(vertexes.end() - 4, vertexes.end());
+        // Faces added later reuse the slots from here on
+        dirtyFirst = std::min(dirtyFirst, faces.size());
     }
 
     void FaceList::render(Texture texture, bool masked) const {
+        if (rebuildBuffer || faces.size() > bufferCapacity) {
+            bufferCapacity = getCapacity();
+            buffer = bufferCapacity == 0 ? nullptr : renderer->makeBuffer(*this);
+            rebuildBuffer = false;
+            updateBuffer = false;
+            uploadedFaces = faces.size();
+            dirtyFirst = SIZE_MAX;
+        } else if (buffer != nullptr) {
+            if (faces.size() != uploadedFaces || dirtyFirst < faces.size()) {
+                Size first = std::min({dirtyFirst, uploadedFaces, faces.size()});
+                buffer->update(*this, first, faces.size() - first);
+                uploadedFaces = faces.size();
+                dirtyFirst = SIZE_MAX;
+            }
+            if (updateBuffer) {
+                buffer->update(*this);
+                updateBuffer = false;
+            }
+        }
+
         if (faces.empty()) {
             return;
         }
@@ -49,14 +80,11 @@ namespace Duel6 {
         buffer->render(material);
     }
 
-    void FaceList::nextFrame() {
-        if (faces.empty()) {
-            return;
-        }
-
-        for (Face &face : faces) {
-            face.nextFrame();
+    void FaceList::setAnimationTime(Float32 time) {
+        Size frame = Size(time / animationSpeed);
+        if (frame != animationFrame && !faces.empty()) {
+            animationFrame = frame;
+            updateBuffer = true;
         }
-        buffer->update(*this);
     }
 }
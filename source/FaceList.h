@@ -28,6 +28,8 @@
 #ifndef DUEL6_FACELIST_H
 #define DUEL6_FACELIST_H
 
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 #include "Vertex.h"
 #include "Face.h"
@@ -39,16 +41,31 @@ namespace Duel6 {
     private:
         std::vector<Vertex> vertexes;
         std::vector<Face> faces;
-        std::unique_ptr<RendererBuffer> buffer;
+        // Buffers are created and updated when rendering so that faces can change on any thread
+        Renderer *renderer;
+        mutable std::unique_ptr<RendererBuffer> buffer;
+        mutable bool rebuildBuffer;
+        mutable bool updateBuffer;
+        mutable Size bufferCapacity;
+        mutable Size uploadedFaces;
+        // First face changed since the last upload: a slot overwritten by a removal or the lowest face count
+        // reached by removals, every face from there to the end is uploaded
+        mutable Size dirtyFirst;
+        Size reservedFaces;
+        Float32 animationSpeed;
+        Size animationFrame;
 
     public:
-        FaceList() {}
+        FaceList()
+                : renderer(nullptr), rebuildBuffer(false), updateBuffer(false), bufferCapacity(0), uploadedFaces(0),
+                  dirtyFirst(SIZE_MAX), reservedFaces(0), animationSpeed(1), animationFrame(0) {}
 
         ~FaceList();
 
         FaceList &clear() {
             vertexes.clear();
             faces.clear();
+            dirtyFirst = 0;
             return *this;
         }
 
@@ -62,6 +79,18 @@ namespace Duel6 {
             return *this;
         }
 
+        /** Moves the last face in place of the removed one, faces changed this way are uploaded when rendering */
+        void removeFace(Size index);
+
+        /** The renderer buffer has room for the given number of faces, faces can be added without recreating it */
+        void reserve(Size faces) {
+            reservedFaces = faces;
+        }
+
+        Size getCapacity() const {
+            return std::max(reservedFaces, faces.size());
+        }
+
         std::vector<Vertex> &getVertexes() {
             return vertexes;
         }
@@ -78,11 +107,21 @@ namespace Duel6 {
             return faces;
         }
 
-        void build(Renderer &renderer);
+        /** Animation frames of all faces change every animationSpeed seconds */
+        void build(Renderer &renderer, Float32 animationSpeed);
 
         void render(Texture texture, bool masked) const;
 
-        void nextFrame();
+        Float32 getAnimationSpeed() const {
+            return animationSpeed;
+        }
+
+        Size getAnimationFrame() const {
+            return animationFrame;
+        }
+
+        /** The frame is derived from the time in the same way as renderers animating faces on the GPU do it */
+        void setAnimationTime(Float32 time);
     };
 }
 
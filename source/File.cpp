@@ -26,6 +26,7 @@
 */
 
 #include <string.h>
+#include <sys/stat.h>
 #include "msdir.h"
 #include "IoException.h"
 #include "File.h"
@@ -107,6 +108,18 @@ namespace Duel6 {
         return *this;
     }
 
+    Size File::getPosition() const {
+        if (handle == nullptr) {
+            D6_THROW(IoException, "Querying position of a closed stream");
+        }
+
+        long position = ftell(handle);
+        if (position < 0) {
+            D6_THROW(IoException, "Unable to get the position in a stream");
+        }
+        return Size(position);
+    }
+
     bool File::isEof() const {
         if (handle == nullptr) {
             D6_THROW(IoException, "Querying closed stream for end of file");
@@ -140,6 +153,19 @@ namespace Duel6 {
 
     }
 
+    bool File::isDirectory(const std::string &path) {
+        struct stat status;
+        return stat(path.c_str(), &status) == 0 && (status.st_mode & S_IFMT) == S_IFDIR;
+    }
+
+    Int64 File::getModificationTime(const std::string &path) {
+        struct stat status;
+        if (stat(path.c_str(), &status) != 0) {
+            return 0;
+        }
+        return Int64(status.st_mtime);
+    }
+
     void File::load(const std::string &path, void *ptr, long offset) {
         Size length = getSize(path) - offset;
         File file(path, File::Mode::Binary, File::Access::Read);
@@ -73,12 +73,19 @@ namespace Duel6 {
 
         File &seek(long offset, Seek seek);
 
+        Size getPosition() const;
+
         bool isEof() const;
 
         static Size getSize(const std::string &path);
 
         static bool exists(const std::string &path);
 
+        static bool isDirectory(const std::string &path);
+
+        /** Seconds since the epoch of the last modification, 0 if the file does not exist */
+        static Int64 getModificationTime(const std::string &path);
+
         static void load(const std::string &path, void *ptr, long offset = 0);
 
         static std::vector<Uint8> load(const std::string &path, long offset = 0);
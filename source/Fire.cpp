@@ -36,10 +36,26 @@ namespace Duel6 {
     namespace {
         AnimationEntry nonFireAnimation[] = {0, 328, -1, 0};
         AnimationEntry burnedAnimation[] = {1, 328, -1, 0};
-        std::vector<AnimationEntry> burningAnimation;
+
+        // Shared by all games and never released, snapshots of a finished round may still show burning sprites
+        const std::vector<AnimationEntry> &getBurningAnimation() {
+            static const std::vector<AnimationEntry> burningAnimation = []() {
+                std::vector<AnimationEntry> animation;
+                for (Int32 j = 0; j < 3; j++) {
+                    for (Int32 i = 0; i < 49; i++) {
+                        animation.push_back(i);
+                        animation.push_back(1);
+                    }
+                }
+                animation.push_back(-1);
+                animation.push_back(0);
+                return animation;
+            }();
+            return burningAnimation;
+        }
     }
 
-    Fire::Fire(const FireType &type, SpriteList::Iterator sprite, const Vector &position)
+    Fire::Fire(const FireType &type, SpriteList::Handle sprite, const Vector &position)
             : type(type), sprite(sprite), position(position), burned(false) {}
 
     FireList::FireList(const GameResources &resources, SpriteList &spriteList)
@@ -80,25 +96,14 @@ namespace Duel6 {
 
             fire.setBurned(true);
 
-            auto sprite = spriteList.add(burningAnimation.data(), burningTexture);
+            auto sprite = spriteList.add(getBurningAnimation().data(), burningTexture);
             sprite->setPosition(fire.getPosition() - Vector(0.3f, 0.2f), 0.78f)
                     .setSize(Vector(1.6f, 1.6f))
                     .setLooping(AnimationLooping::OnceAndRemove)
-                    .setBlendFunc(BlendFunc::SrcColor)
-                    .setOnFinished([&fire]() {
-                        fire.getSprite()->setAnimation(burnedAnimation);
-                    });
-        }
-    }
-
-    void FireList::initialize() {
-        for (Int32 j = 0; j < 3; j++) {
-            for (Int32 i = 0; i < 49; i++) {
-                burningAnimation.push_back(i);
-                burningAnimation.push_back(1);
-            }
+                    .setBlendFunc(BlendFunc::SrcColor);
+            spriteList.setOnFinished(sprite, [&fire]() {
+                fire.getSprite()->setAnimation(burnedAnimation);
+            });
         }
-        burningAnimation.push_back(-1);
-        burningAnimation.push_back(0);
     }
 }
@@ -69,12 +69,12 @@ namespace Duel6 {
     class Fire {
     private:
         const FireType &type;
-        SpriteList::Iterator sprite;
+        SpriteList::Handle sprite;
         Vector position;
         bool burned;
 
     public:
-        Fire(const FireType &type, SpriteList::Iterator sprite, const Vector &position);
+        Fire(const FireType &type, SpriteList::Handle sprite, const Vector &position);
 
         const FireType &getType() const {
             return type;
@@ -88,7 +88,7 @@ namespace Duel6 {
             return position + Vector(0.5f, 0.5f);
         }
 
-        SpriteList::Iterator getSprite() const {
+        SpriteList::Handle getSprite() const {
             return sprite;
         }
 
@@ -114,8 +114,6 @@ namespace Duel6 {
         void find(const Level &level);
 
         void check(const Vector &explCentre, Float32 d);
-
-        static void initialize();
     };
 }
 
@@ -25,18 +25,40 @@
 * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
-#include <list>
-#include <unordered_map>
+#include <algorithm>
+#include <vector>
 #include "console/Console.h"
 #include "Font.h"
 #include "FontException.h"
+#include "Image.h"
 #include "Video.h"
 
 namespace Duel6 {
+    namespace {
+        // Printable ASCII followed by the printable Latin-1 characters, strings are Latin-1 encoded
+        const Uint8 FIRST_ASCII_GLYPH = ' ';
+        const Uint8 LAST_ASCII_GLYPH = '~';
+        const Uint8 FIRST_LATIN1_GLYPH = 0xA0;
+        const Size ASCII_GLYPH_COUNT = LAST_ASCII_GLYPH - FIRST_ASCII_GLYPH + 1;
+        const char FALLBACK_GLYPH = '?';
+
+        Uint16 getGlyphCharacter(Size index) {
+            return index < ASCII_GLYPH_COUNT ? Uint16(FIRST_ASCII_GLYPH + index)
+                                             : Uint16(FIRST_LATIN1_GLYPH + index - ASCII_GLYPH_COUNT);
+        }
+        const Color EMPTY_TEXEL(255, 255, 255, 0);
+    }
+
     Font::Font(Renderer &renderer)
-            : font(nullptr), renderer(renderer), fontCache(renderer, 100) {}
+            : font(nullptr), renderer(renderer), atlas(0), atlasLoaded(false) {
+        // Fixed width until the metrics of a font are known
+        glyphs.fill(Glyph{0.5f, 0.5f, 1.0f});
+    }
 
     Font::~Font() {
+        if (atlasLoaded) {
+            renderer.freeTexture(atlas);
+        }
         if (font != nullptr) {
             TTF_CloseFont(font);
             font = nullptr;
@@ -49,14 +71,90 @@ namespace Duel6 {
         if (font == nullptr) {
             D6_THROW(FontException, Format("Unable to load font {0} due to error: {1}") << fontFile << TTF_GetError());
         }
+        createAtlas();
+    }
+
+    void Font::createAtlas() {
+        std::vector<Image> images;
+        std::vector<Int32> advances;
+        Size cellWidth = 1;
+        Size cellHeight = Size(std::max(TTF_FontHeight(font), 1));
+        Int32 asciiAdvance = 0;
+
+        for (Size i = 0; i < GLYPH_COUNT; i++) {
+            Uint16 ch = getGlyphCharacter(i);
+            Int32 minX, maxX, minY, maxY, advance;
+            if (TTF_GlyphMetrics(font, ch, &minX, &maxX, &minY, &maxY, &advance) != 0) {
+                advance = 0;
+            }
+            advances.push_back(advance);
+            if (i < ASCII_GLYPH_COUNT) {
+                asciiAdvance += advance;
+            }
+
+            // Glyphs missing in the font stay empty
+            SDL_Surface *surface = TTF_RenderGlyph_Blended(font, ch, SDL_Color{255, 255, 255, 255});
+            if (surface != nullptr) {
+                images.push_back(Image::fromSurface(surface));
+                SDL_FreeSurface(surface);
+            } else {
+                images.push_back(Image());
+            }
+            cellWidth = std::max(cellWidth, images.back().getWidth());
+            cellHeight = std::max(cellHeight, images.back().getHeight());
+        }
+
+        // The console and the GUI lay text out in cells of half the line height, glyphs are scaled horizontally
+        // so that an average ASCII character keeps this width
+        Float32 lineHeight = Float32(std::max(TTF_FontHeight(font), 1));
+        Float32 averageAdvance = asciiAdvance > 0 ? Float32(asciiAdvance) / ASCII_GLYPH_COUNT : lineHeight / 2;
+        Float32 widthScale = 0.5f / averageAdvance;
+
+        Image image(cellWidth, cellHeight, GLYPH_COUNT);
+        for (Size i = 0; i < GLYPH_COUNT; i++) {
+            const Image &glyphImage = images[i];
+            Color *cell = &image.at(i * cellWidth * cellHeight);
+            for (Size y = 0; y < cellHeight; y++) {
+                for (Size x = 0; x < cellWidth; x++) {
+                    bool inside = x < glyphImage.getWidth() && y < glyphImage.getHeight();
+                    cell[y * cellWidth + x] = inside ? glyphImage.at(y * glyphImage.getWidth() + x) : EMPTY_TEXEL;
+                }
+            }
+
+            Glyph &glyph = glyphs[i];
+            glyph.advance = advances[i] * widthScale;
+            glyph.width = glyphImage.getWidth() * widthScale;
+            glyph.textureWidth = Float32(glyphImage.getWidth()) / cellWidth;
+        }
+
+        if (atlasLoaded) {
+            renderer.freeTexture(atlas);
+        }
+        atlas = renderer.createTexture(image, TextureFilter::Linear, true);
+        atlasLoaded = true;
+    }
+
+    Size Font::getGlyphIndex(char c) const {
+        Uint8 ch = Uint8(c);
+        if (ch >= FIRST_ASCII_GLYPH && ch <= LAST_ASCII_GLYPH) {
+            return Size(ch - FIRST_ASCII_GLYPH);
+        }
+        if (ch >= FIRST_LATIN1_GLYPH) {
+            return ASCII_GLYPH_COUNT + Size(ch - FIRST_LATIN1_GLYPH);
+        }
+        return Size(FALLBACK_GLYPH - FIRST_ASCII_GLYPH);
     }
 
     Float32 Font::getTextWidth(const std::string &str, Float32 height) const {
-        return str.size() * (height / 2.0f);
+        Float32 width = 0;
+        for (char c : str) {
+            width += glyphs[getGlyphIndex(c)].advance;
+        }
+        return width * height;
     }
 
     Int32 Font::getTextWidth(const std::string &str, Int32 height) const {
-        return Int32(str.size() * height) / 2;
+        return Int32(getTextWidth(str, Float32(height)));
     }
 
     void Font::print(Int32 x, Int32 y, const Color &color, const std::string &str) const {
@@ -65,35 +163,42 @@ namespace Duel6 {
 
     void
     Font::print(Float32 x, Float32 y, Float32 z, const Color &color, const std::string &str, Float32 height) const {
-        if (str.length() < 1) {
+        if (str.length() < 1 || !atlasLoaded) {
             return;
         }
 
-        Texture texture = getTexture(str);
-        Material material = Material::makeColoredTexture(texture, color);
-        Float32 width = getTextWidth(str, height);
+        Material material = Material::makeColoredTexture(atlas, color);
 
         renderer.setBlendFunc(BlendFunc::SrcAlpha);
-        renderer.quadXY(Vector(x, y, z), Vector(width, height), Vector(0, 1), Vector(1, -1), material);
+        for (char c : str) {
+            Size index = getGlyphIndex(c);
+            const Glyph &glyph = glyphs[index];
+            if (c != ' ') {
+                renderer.quadXY(Vector(x, y, z), Vector(glyph.width * height, height),
+                                Vector(0.0f, 1.0f, Float32(index)), Vector(glyph.textureWidth, -1.0f), material);
+            }
+            x += glyph.advance * height;
+        }
         renderer.setBlendFunc(BlendFunc::None);
     }
 
-    Texture Font::getTexture(const std::string &text) const {
-        if (fontCache.has(text)) {
-            return fontCache.get(text);
+    void Font::print(RenderQueue &queue, Uint32 layer, const RenderQueue::State &state, Float32 x, Float32 y,
+                     Float32 z, const Color &color, const std::string &str, Float32 height) const {
+        if (str.length() < 1 || !atlasLoaded) {
+            return;
         }
-        Texture texture = renderText(text);
-        fontCache.add(text, texture);
-        return texture;
-    }
-
-    Texture Font::renderText(const std::string &text) const {
-        SDL_Surface *surface = TTF_RenderText_Blended(font, text.c_str(), SDL_Color{255, 255, 255, 255});
-        Image image = Image::fromSurface(surface);
-        SDL_FreeSurface(surface);
 
-        Texture texture = renderer.createTexture(image, TextureFilter::Linear, true);
+        Material material = Material::makeColoredTexture(atlas, color);
+        RenderQueue::State textState = {state.depthTest, state.depthWrite, BlendFunc::SrcAlpha};
 
-        return texture;
+        for (char c : str) {
+            Size index = getGlyphIndex(c);
+            const Glyph &glyph = glyphs[index];
+            if (c != ' ') {
+                queue.quadXY(layer, textState, Vector(x, y, z), Vector(glyph.width * height, height),
+                             Vector(0.0f, 1.0f, Float32(index)), Vector(glyph.textureWidth, -1.0f), material);
+            }
+            x += glyph.advance * height;
+        }
     }
-}
\ No newline at end of file
+}
@@ -28,7 +28,7 @@
 #ifndef DUEL6_FONT_H
 #define DUEL6_FONT_H
 
-#include <vector>
+#include <array>
 
 #include <SDL2/SDL_ttf.h>
 #include "Type.h"
@@ -36,16 +36,32 @@
 #include "Format.h"
 #include "renderer/RendererTypes.h"
 #include "renderer/Renderer.h"
-#include "FontCache.h"
+#include "renderer/RenderQueue.h"
 
 namespace Duel6 {
     class Console;
 
+    /**
+     * Text is drawn as quads of glyphs from a texture array with one printable ASCII or Latin-1 character per layer.
+     * The atlas is rendered once when the font is loaded, control characters are drawn as '?'.
+     */
     class Font {
+    private:
+        static const Size GLYPH_COUNT = 95 + 96;
+
+        // Dimensions relative to the line height
+        struct Glyph {
+            Float32 advance;
+            Float32 width;
+            Float32 textureWidth;
+        };
+
     private:
         TTF_Font *font;
         Renderer &renderer;
-        FontCache fontCache;
+        Texture atlas;
+        bool atlasLoaded;
+        std::array<Glyph, GLYPH_COUNT> glyphs;
 
     public:
         Font(Renderer &renderer);
@@ -58,6 +74,10 @@ namespace Duel6 {
 
         void print(Float32 x, Float32 y, Float32 z, const Color &color, const std::string &str, Float32 height) const;
 
+        /** Queues the text, it is always alpha blended */
+        void print(RenderQueue &queue, Uint32 layer, const RenderQueue::State &state, Float32 x, Float32 y, Float32 z,
+                   const Color &color, const std::string &str, Float32 height) const;
+
         Float32 getTextWidth(const std::string &str, Float32 height) const;
 
         Int32 getTextWidth(const std::string &str, Int32 height) const;
@@ -71,9 +91,9 @@ namespace Duel6 {
         }
 
     private:
-        Texture getTexture(const std::string &text) const;
+        void createAtlas();
 
-        Texture renderText(const std::string &text) const;
+        Size getGlyphIndex(char c) const;
     };
 }
 
@@ -26,6 +26,7 @@
 */
 
 #include "Sound.h"
+#include "GameException.h"
 #include "WorldRenderer.h"
 #include "Game.h"
 #include "Menu.h"
@@ -33,8 +34,10 @@
 
 namespace Duel6 {
     Game::Game(AppService &appService, GameResources &resources, GameSettings &settings)
-            : appService(appService), resources(resources), settings(settings), worldRenderer(appService, *this),
-              playedRounds(0) {}
+            : appService(appService), resources(resources), settings(settings),
+              levelCache(resources.getBlockMeta()), worldRenderer(appService, *this),
+              menu(nullptr), playedRounds(0), startedRounds(0), replayPlayback(nullptr),
+              randomEngine(std::random_device()()), snapshotsRequested(false) {}
 
     void Game::beforeStart(Context *prevContext) {
         SDL_ShowCursor(SDL_DISABLE);
@@ -44,22 +47,37 @@ namespace Duel6 {
         endRound();
     }
 
-    void Game::render() const {
-        worldRenderer.render();
+    void Game::render(Float32 interpolation) const {
+        snapshotsRequested.store(true, std::memory_order_relaxed);
+        snapshots.consume();
+        const GameSnapshot &snapshot = snapshots.getReadBuffer();
+        if (snapshot.valid) {
+            worldRenderer.render(snapshot, interpolation);
+        }
     }
 
     void Game::update(Float32 elapsedTime) {
-        if (getRound().isOver()) {
-            if (!getRound().isLast()) {
+        Math::RandomScope randomScope(randomEngine);
+        if (getRound().isOver() || getRound().isReplayExhausted()) {
+            if (!isOver()) {
                 nextRound();
-
             }
         } else {
             getRound().update(elapsedTime);
         }
+
+        if (snapshotsRequested.load(std::memory_order_relaxed)) {
+            publishSnapshot();
+        }
+    }
+
+    void Game::publishSnapshot() {
+        snapshots.getWriteBuffer().capture(*this);
+        snapshots.publish();
     }
 
     void Game::keyEvent(const KeyPressEvent &event) {
+        Math::RandomScope randomScope(randomEngine);
         if (event.getCode() == SDLK_ESCAPE && (isOver() || event.withShift())) {
             close();
             return;
@@ -97,6 +115,7 @@ namespace Duel6 {
     void Game::start(const std::vector<PlayerDefinition> &playerDefinitions, const std::vector<std::string> &levels,
                      const std::vector<Size> &backgrounds, ScreenMode screenMode, Int32 screenZoom,
                      GameMode &gameMode) {
+        Math::RandomScope randomScope(randomEngine);
         Console &console = appService.getConsole();
         console.printLine("\n=== Starting new game ===");
         console.printLine(Format("...Rounds: {0}") << settings.getMaxRounds());
@@ -119,36 +138,91 @@ namespace Duel6 {
             playerIndex++;
         }
 
+        replay.clear();
+        replay.setSettings(gameMode.getName(), settings);
+        for (const Player &player : players) {
+            replay.addPlayer(player.getPerson().getName());
+        }
+
+        if (replayPlayback != nullptr && replayPlayback->getPlayerNames().size() != players.size()) {
+            D6_THROW(GameException, Format("Replay requires {0} players") << replayPlayback->getPlayerNames().size());
+        }
+
+        if (settings.isDeterministic()) {
+            console.printLine(Format("...Seed: {0}") << settings.getSeed());
+            randomEngine.seed(settings.getSeed());
+        }
+
         this->levels = levels;
-        std::shuffle(this->levels.begin(), this->levels.end(), Math::randomEngine);
+        std::shuffle(this->levels.begin(), this->levels.end(), randomEngine);
 
         this->backgrounds = backgrounds;
         this->gameMode = &gameMode;
         settings.setScreenMode(screenMode);
         settings.setScreenZoom(screenZoom);
         gameMode.initializeGame(*this, players, settings.isQuickLiquid(), settings.isGlobalAssistances());
+        startedRounds = 0;
         startRound();
+        publishSnapshot();
     }
 
     void Game::startRound() {
         currentRound = playedRounds;
         displayScoreTab = false;
 
-        bool shuffle = settings.getLevelSelectionMode() == LevelSelectionMode::Shuffle;
-        Int32 level = shuffle ? playedRounds % Int32(levels.size()) : Math::random(Int32(levels.size()));
-        const std::string levelPath = levels[level];
-        bool mirror = Math::random(2) == 0;
+        std::string levelPath;
+        bool mirror;
+        Uint32 seed;
+        if (replayPlayback != nullptr) {
+            if (startedRounds >= replayPlayback->getRounds().size()) {
+                D6_THROW(GameException, "Replay contains no more rounds");
+            }
+            const Replay::Round &recorded = replayPlayback->getRounds()[startedRounds];
+            levelPath = recorded.getLevel();
+            mirror = recorded.isMirror();
+            seed = recorded.getSeed();
+        } else {
+            bool shuffle = settings.getLevelSelectionMode() == LevelSelectionMode::Shuffle;
+            Int32 level = shuffle ? playedRounds % Int32(levels.size()) : Math::random(Int32(levels.size()));
+            levelPath = levels[level];
+            mirror = Math::random(2) == 0;
+            seed = settings.isDeterministic() ? settings.getSeed() ^ (Uint32(startedRounds) * 0x9E3779B9u)
+                                              : Uint32(randomEngine());
+        }
+
+        // Everything random in the round derives from its seed, the round can then be replayed from inputs only
+        randomEngine.seed(seed);
 
         Console &console = appService.getConsole();
         console.printLine(Format("\n===Loading level {0}===") << levelPath);
-        console.printLine(Format("...Parameters: mirror: {0}") << mirror);
+        console.printLine(Format("...Parameters: mirror: {0}, seed: {1}") << mirror << seed);
 
         round = std::make_unique<Round>(*this, playedRounds, levelPath, mirror);
         round->setOnRoundEnd([this]() {
             onRoundEnd();
         });
+        if (replayPlayback != nullptr) {
+            round->setReplayPlayback(&replayPlayback->getRounds()[startedRounds]);
+        } else {
+            round->setReplayRecording(&replay.addRound(seed, levelPath, mirror));
+        }
+        startedRounds++;
         round->start();
-        worldRenderer.prerender();
+        prefetchNextLevel();
+    }
+
+    void Game::prefetchNextLevel() {
+        if (replayPlayback != nullptr) {
+            if (startedRounds < replayPlayback->getRounds().size()) {
+                const Replay::Round &recorded = replayPlayback->getRounds()[startedRounds];
+                levelCache.prefetch(recorded.getLevel(), recorded.isMirror());
+            }
+        } else if (settings.getLevelSelectionMode() == LevelSelectionMode::Shuffle && !round->isLast()) {
+            // Whether the level is mirrored is decided only when the round starts
+            const std::string &levelPath = levels[(playedRounds + 1) % Int32(levels.size())];
+            levelCache.prefetch(levelPath, false);
+            levelCache.prefetch(levelPath, true);
+        }
     }
 
     void Game::endRound() {
@@ -160,7 +234,9 @@ namespace Duel6 {
         if (round->isLast()) {
             getMode().updateElo(players);
         }
-        menu->savePersonData();
+        if (menu != nullptr) {
+            menu->savePersonData();
+        }
     }
 
     void Game::nextRound() {
@@ -28,6 +28,7 @@
 #ifndef DUEL6_GAME_H
 #define DUEL6_GAME_H
 
+#include <atomic>
 #include <utility>
 #include <vector>
 #include <queue>
@@ -39,11 +40,16 @@
 #include "World.h"
 #include "Player.h"
 #include "WorldRenderer.h"
+#include "GameSnapshot.h"
+#include "TripleBuffer.h"
 #include "Water.h"
 #include "AppService.h"
 #include "GameSettings.h"
 #include "GameResources.h"
 #include "Round.h"
+#include "Replay.h"
+#include "LevelCache.h"
+#include "math/Math.h"
 
 namespace Duel6 {
     class GameMode;
@@ -90,6 +96,8 @@ namespace Duel6 {
         GameResources &resources;
         GameSettings &settings;
         GameMode *gameMode;
+        // Used by the simulation to load levels and by the renderer to take their prepared faces
+        mutable LevelCache levelCache;
         std::unique_ptr<Round> round;
         WorldRenderer worldRenderer;
         const Menu *menu;
@@ -99,6 +107,15 @@ namespace Duel6 {
 
         Int32 currentRound;
         Int32 playedRounds;
+        Size startedRounds;
+
+        Replay replay;
+        const Replay *replayPlayback;
+        // Every random decision of the game comes from this engine, games can then run on separate threads
+        Math::RandomEngine randomEngine;
+        // Snapshots are taken after each tick once the game has been rendered, headless games never take them
+        mutable TripleBuffer<GameSnapshot> snapshots;
+        mutable std::atomic<bool> snapshotsRequested;
 
         std::vector<Player> players;
         std::vector<PlayerSkin> skins;
@@ -127,7 +144,11 @@ namespace Duel6 {
 
         void update(Float32 elapsedTime) override;
 
-        void render() const override;
+        void render(Float32 interpolation) const override;
+
+        bool isSimulatedConcurrently() const override {
+            return true;
+        }
 
         AppService &getAppService() const {
             return appService;
@@ -161,6 +182,10 @@ namespace Duel6 {
             return settings;
         }
 
+        LevelCache &getLevelCache() const {
+            return levelCache;
+        }
+
         Round &getRound() {
             return *round;
         }
@@ -180,7 +205,23 @@ namespace Duel6 {
         Int32 getCurrentRound() const;
 
         bool isOver() const {
-            return getRound().isLast() && getRound().isOver();
+            return (getRound().isLast() && getRound().isOver()) || isReplayOver();
+        }
+
+        /** The replay being played back has no more recorded ticks */
+        bool isReplayOver() const {
+            return replayPlayback != nullptr && startedRounds >= replayPlayback->getRounds().size() &&
+                   getRound().isReplayExhausted();
+        }
+
+        /** Recording of the current game */
+        const Replay &getReplay() const {
+            return replay;
+        }
+
+        /** Play back the given replay in the next game instead of reading player controls and scripts */
+        void setReplayPlayback(const Replay *replay) {
+            replayPlayback = replay;
         }
 
         bool isDisplayingScoreTab() const {
@@ -214,11 +255,16 @@ namespace Duel6 {
 
         void startRound();
 
+        /** Loads the level of the next round in the background if it is already known */
+        void prefetchNextLevel();
+
         void nextRound();
 
         void endRound();
 
         void onRoundEnd();
+
+        void publishSnapshot();
     };
 }
 
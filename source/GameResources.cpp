@@ -32,17 +32,25 @@
 #include "Bonus.h"
 
 namespace Duel6 {
-    void GameResources::load(Console &console, Sound &sound, TextureManager &textureManager) {
+    void GameResources::load(Console &console, Sound &sound, TextureManager &textureManager, PhaseTimer &timer) {
         console.printLine("\n===Initializing game resources===");
+        console.printLine("...Decoding textures");
+        textureManager.decode({D6_TEXTURE_WPN_PATH, D6_TEXTURE_WATER_PATH, D6_TEXTURE_BLOCK_PATH, D6_TEXTURE_EXPL_PATH,
+                               D6_TEXTURE_BONUS_PATH, D6_TEXTURE_ELEVATOR_PATH, D6_TEXTURE_BCG_PATH,
+                               D6_TEXTURE_FIRE_PATH});
+        timer.endPhase("Texture decoding");
         console.printLine("\n...Weapon initialization");
         Weapon::initialize(sound, textureManager);
+        timer.endPhase("Weapons");
         console.printLine("...Building water-list");
         Water::initialize(sound, textureManager);
+        timer.endPhase("Water");
         console.printLine("...Loading game sounds");
         roundStartSound = sound.loadSample("sound/game/round-start.wav");
         gameOverSound = sound.loadSample("sound/game/game-over.wav");
         console.printLine(Format("...Loading block meta data: {0}") << D6_FILE_BLOCK_META);
         blockMeta = Block::loadMeta(D6_FILE_BLOCK_META);
+        timer.endPhase("Sounds and block meta data");
         console.printLine(Format("...Loading block textures: {0}") << D6_TEXTURE_BLOCK_PATH);
         blockTextures = textureManager.loadStack(D6_TEXTURE_BLOCK_PATH, TextureFilter::Linear, true);
         console.printLine(Format("...Loading explosion textures: {0}") << D6_TEXTURE_EXPL_PATH);
@@ -54,9 +62,11 @@ namespace Duel6 {
 
         console.printLine(Format("...Loading background textures: {0}") << D6_TEXTURE_BCG_PATH);
         bcgTextures = textureManager.loadDict(D6_TEXTURE_BCG_PATH, TextureFilter::Linear, true);
+        timer.endPhase("Level textures");
         std::string animationPath(D6_TEXTURE_MAN_PATH);
         animationPath += "man.ase";
         playerAnimation = textureManager.loadAnimation(animationPath);
+        timer.endPhase("Player animation");
         console.printLine(Format("...Loading fire textures: {0}") << D6_TEXTURE_FIRE_PATH);
         for (const FireType &fireType : FireType::values()) {
             Texture texture = textureManager.loadStack(Format("{0}{1,3|0}/") << D6_TEXTURE_FIRE_PATH << fireType.getId(),
@@ -66,5 +76,12 @@ namespace Duel6 {
 
         Texture burn = textureManager.loadStack("textures/fire/burn/", TextureFilter::Linear, true);
         burningTexture = burn;
+        timer.endPhase("Fire textures");
+
+        // Images decoded ahead but not used by any texture would stay in memory for the rest of the process
+        Size unusedImages = textureManager.discardDecodedImages();
+        if (unusedImages > 0) {
+            console.printLine(Format("...Discarded unused decoded images: {0}") << unusedImages);
+        }
     }
 }
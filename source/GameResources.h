@@ -32,6 +32,7 @@
 #include "Water.h"
 #include "Block.h"
 #include "AppService.h"
+#include "PhaseTimer.h"
 #include "aseprite/animation.h"
 namespace Duel6 {
     class GameResources {
@@ -52,7 +53,7 @@ namespace Duel6 {
         animation::Animation playerAnimation;
 
     public:
-        void load(Console &console, Sound &sound, TextureManager &textureManager);
+        void load(Console &console, Sound &sound, TextureManager &textureManager, PhaseTimer &timer);
 
         const Block::Meta &getBlockMeta() const {
             return blockMeta;
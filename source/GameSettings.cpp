@@ -33,7 +33,8 @@ namespace Duel6 {
               screenZoom(13), wireframe(false), showFps(false), showRanking(true),
               ghostMode(false), quickLiquid(true), globalAssistances(true),
               shotCollision(ShotCollisionSetting::Large),
-              levelSelectionMode(LevelSelectionMode::Random) {}
+              levelSelectionMode(LevelSelectionMode::Random),
+              deterministic(false), seed(0) {}
 
     GameSettings &GameSettings::enableWeapon(const Weapon &weapon, bool enable) {
         if (enable) {
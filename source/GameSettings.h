@@ -64,6 +64,8 @@ namespace Duel6 {
         ShotCollisionSetting shotCollision;
         EnabledWeapons enabledWeapons;
         LevelSelectionMode levelSelectionMode;
+        bool deterministic;
+        Uint32 seed;
 
     public:
         GameSettings();
@@ -113,7 +115,7 @@ namespace Duel6 {
             return *this;
         }
 
-        bool isGhostEnabled() {
+        bool isGhostEnabled() const {
             return this->ghostMode;
         }
 
@@ -162,6 +164,25 @@ namespace Duel6 {
             return *this;
         }
 
+        bool isDeterministic() const {
+            return deterministic;
+        }
+
+        /** Derive all randomness from a fixed seed so that the same inputs always produce the same game */
+        GameSettings &setDeterministic(bool deterministic) {
+            this->deterministic = deterministic;
+            return *this;
+        }
+
+        Uint32 getSeed() const {
+            return seed;
+        }
+
+        GameSettings &setSeed(Uint32 seed) {
+            this->seed = seed;
+            return *this;
+        }
+
         GameSettings &enableWeapon(const Weapon &weapon, bool enable);
 
         bool isWeaponEnabled(const Weapon &weapon) const;
@@ -0,0 +1,86 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "GameSnapshot.h"
+#include "Game.h"
+#include "GameMode.h"
+
+namespace Duel6 {
+    GameSnapshot::GameSnapshot()
+            : valid(false), worldTime(0), waterLevel(0), currentRound(0), winner(false), gameOver(false),
+              displayScoreTab(false), remainingYouAreHere(0), remainingGameOverWait(0), messages(0) {}
+
+    void GameSnapshot::capture(Game &game) {
+        Round &round = game.getRound();
+        World &world = round.getWorld();
+
+        valid = true;
+        worldTime = world.getTime();
+        background = world.getBackground();
+        level = world.getInitialLevel();
+        waterLevel = world.getLevel().getWaterLevel();
+        currentRound = game.getCurrentRound();
+        winner = round.hasWinner();
+        gameOver = game.isOver();
+        displayScoreTab = game.isDisplayingScoreTab();
+        remainingYouAreHere = round.getRemainingYouAreHere();
+        remainingGameOverWait = round.getRemainingGameOverWait();
+        ranking = game.getMode().getRanking(game.getPlayers());
+
+        std::vector<Player> &gamePlayers = game.getPlayers();
+        players.resize(gamePlayers.size());
+        for (Size i = 0; i < gamePlayers.size(); i++) {
+            Player &player = gamePlayers[i];
+            PlayerState &state = players[i];
+            state.name = player.getPerson().getName();
+            state.view = player.getView();
+            state.camera = player.getCamera();
+            state.indicators = player.getIndicators();
+            state.centre = player.getCentre();
+            player.takeSnapshot(state.previousCentre, state.previousCameraPosition);
+            state.dimensions = player.getDimensions();
+            state.collisionRect = player.getCollisionRect();
+            state.bonus = player.getBonus();
+            state.bonusRemainingTime = player.getBonusRemainingTime();
+            state.bonusDuration = player.getBonusDuration();
+            state.reloadInterval = player.getReloadInterval();
+            state.reloadTime = player.getReloadTime();
+            state.air = player.getAir();
+            state.life = player.getLife();
+            state.ammo = player.getAmmo();
+            state.roundKills = player.getRoundKills();
+            state.alive = player.isAlive();
+            state.invulnerable = player.isInvulnerable();
+        }
+
+        world.getSpriteList().snapshot(sprites);
+        explosions = world.getExplosionList().getExplosions();
+        world.getElevatorList().snapshot(elevators, previousElevators);
+        world.getBonusList().snapshot(bonuses, weapons);
+        world.getMessageQueue().snapshot(messages, gamePlayers);
+    }
+}
@@ -0,0 +1,112 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef DUEL6_GAMESNAPSHOT_H
+#define DUEL6_GAMESNAPSHOT_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "Type.h"
+#include "Bonus.h"
+#include "Explosion.h"
+#include "InfoMessageQueue.h"
+#include "Level.h"
+#include "PlayerIndicators.h"
+#include "PlayerView.h"
+#include "Ranking.h"
+#include "Rectangle.h"
+#include "SpriteList.h"
+#include "math/Camera.h"
+
+namespace Duel6 {
+    class Game;
+
+    /**
+     * Everything WorldRenderer draws, copied from the game after each tick so that the simulation can continue
+     * while the copy is rendered. A snapshot does not point to data owned by its round, snapshots of a finished
+     * round can still be rendered.
+     */
+    class GameSnapshot {
+    public:
+        struct PlayerState {
+            std::string name;
+            PlayerView view;
+            Camera camera;
+            PlayerIndicators indicators;
+            Vector centre;
+            Vector previousCentre;
+            Vector previousCameraPosition;
+            Vector dimensions;
+            Rectangle collisionRect = Rectangle::empty();
+            const BonusType *bonus = nullptr;
+            Float32 bonusRemainingTime = 0;
+            Float32 bonusDuration = 0;
+            Float32 reloadInterval = 0;
+            Float32 reloadTime = 0;
+            Float32 air = 0;
+            Float32 life = 0;
+            Int32 ammo = 0;
+            Int32 roundKills = 0;
+            bool alive = false;
+            bool invulnerable = false;
+        };
+
+    public:
+        bool valid;
+        Float32 worldTime;
+        std::string background;
+        std::shared_ptr<const Level> level;
+        Int32 waterLevel;
+        Int32 currentRound;
+        bool winner;
+        bool gameOver;
+        bool displayScoreTab;
+        Float32 remainingYouAreHere;
+        Float32 remainingGameOverWait;
+        Ranking ranking;
+        std::vector<PlayerState> players;
+        SpriteList::Snapshot sprites;
+        std::vector<Explosion> explosions;
+        std::vector<Vector> elevators;
+        std::vector<Vector> previousElevators;
+        std::vector<Bonus> bonuses;
+        std::vector<LyingWeapon> weapons;
+        InfoMessageQueue messages;
+
+    public:
+        GameSnapshot();
+
+        /**
+         * Containers keep their capacity so that taking a snapshot every tick does not allocate. Positions
+         * of the previous capture are kept to interpolate between the two.
+         */
+        void capture(Game &game);
+    };
+}
+
+#endif
@@ -0,0 +1,882 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <thread>
+#include <SDL2/SDL_ttf.h>
+#include "Defines.h"
+#include "GameException.h"
+#include "File.h"
+#include "FontException.h"
+#include "LevelList.h"
+#include "PhaseTimer.h"
+#include "math/Math.h"
+#include "ShotList.h"
+#include "collision/Collision.h"
+#include "json/JsonParser.h"
+#include "json/JsonStreamParser.h"
+#include "json/JsonWriter.h"
+#include "gamemodes/DeathMatch.h"
+#include "gamemodes/TeamDeathMatch.h"
+#include "gamemodes/Predator.h"
+#include "renderer/null/NullRenderer.h"
+#include "HeadlessApplication.h"
+
+namespace Duel6 {
+    namespace {
+        const Float64 updateTime = 1.0 / D6_UPDATE_FREQUENCY;
+
+        void addGameModes(std::vector<std::unique_ptr<GameMode>> &gameModes) {
+            gameModes.push_back(std::make_unique<DeathMatch>());
+            gameModes.push_back(std::make_unique<Predator>());
+            gameModes.push_back(std::make_unique<TeamDeathMatch>(2, false));
+            gameModes.push_back(std::make_unique<TeamDeathMatch>(2, true));
+            gameModes.push_back(std::make_unique<TeamDeathMatch>(3, false));
+            gameModes.push_back(std::make_unique<TeamDeathMatch>(3, true));
+            gameModes.push_back(std::make_unique<TeamDeathMatch>(4, false));
+            gameModes.push_back(std::make_unique<TeamDeathMatch>(4, true));
+        }
+    }
+
+    HeadlessApplication::HeadlessApplication(Int32 argc, char **argv)
+            : console(Console::ExpandFlag | Console::StdOutFlag), input(console), controlsManager(input),
+              sound(console), scriptContext(console, sound, gameSettings), scriptManager(scriptContext),
+              gameModeIndex(0), maxTicks(0), benchmarkGridRects(0), benchmarkPlayerShots(0),
+              benchmarkSprites(0), benchmarkTexts(0), benchmarkJson(0), parallelGames(0),
+              jobWorkers(JobSystem::getDefaultWorkerCount()), renderFrames(false),
+              verifyBuffers(false) {
+        console.printLine("\n===Application information===");
+        console.printLine(Format("{0} version: {1} (headless)") << APP_NAME << APP_VERSION);
+
+        Console::registerBasicCommands(console);
+
+        addGameModes(gameModes);
+
+        gameSettings.setMaxRounds(1);
+        parseArguments(argc, argv);
+
+        PhaseTimer timer;
+        console.printLine("\n===Video initialization==");
+        video = std::make_unique<Video>(APP_NAME, APP_FILE_ICON, console);
+        jobSystem = std::make_unique<JobSystem>(jobWorkers);
+        console.printLine(Format("...Job system workers: {0}") << jobSystem->getWorkerCount());
+        textureManager = std::make_unique<TextureManager>(video->getRenderer(), *jobSystem);
+        font = std::make_unique<Font>(video->getRenderer());
+        if (!renderTracePath.empty()) {
+            static_cast<NullRenderer &>(video->getRenderer()).setTraceFile(renderTracePath);
+        }
+        static_cast<NullRenderer &>(video->getRenderer()).setVerifyBuffers(verifyBuffers);
+        timer.endPhase("Video");
+
+        service = std::make_unique<AppService>(*font, console, *textureManager, *video, input, controlsManager, sound,
+                                               scriptManager, *jobSystem);
+
+        gameResources.load(console, sound, *textureManager, timer);
+        game = std::make_unique<Game>(*service, gameResources, gameSettings);
+
+        for (Weapon weapon : Weapon::values()) {
+            gameSettings.enableWeapon(weapon, true);
+        }
+        if (replay) {
+            replay->applySettings(gameSettings);
+            game->setReplayPlayback(replay.get());
+        }
+
+        scriptManager.registerLoaders();
+        loadPersonProfiles(D6_FILE_PROFILES);
+        timer.endPhase("Profiles");
+        timer.print(console, "Startup times");
+    }
+
+    void HeadlessApplication::printUsage() {
+        printf("Usage: duel6r-headless [options]\n"
+               "  -player <name>[:<profile>]  add a player, profile scripts control the player (at least 2)\n"
+               "  -level <path>               play the given level, may be repeated (default: all levels)\n"
+               "  -rounds <count>             number of rounds to play (default: 1)\n"
+               "  -mode <index>               game mode: 0 deathmatch, 1 predator, 2-7 team deathmatch\n"
+               "  -ticks <count>              stop after the given number of updates (default: no limit)\n"
+               "  -quick-liquid               raise water from the beginning of each round\n"
+               "  -jobs <workers>             number of job system worker threads (default: hardware threads - 1)\n"
+               "  -shot-collision <index>     shot collisions: 0 none, 1 large shots (default), 2 all\n"
+               "  -seed <number>              derive all randomness from the seed\n"
+               "  -record <file>              save a replay of the game\n"
+               "  -replay <file>              play back a recorded game and verify its checksums\n"
+               "  -render                     render every tick with the null renderer and print command statistics\n"
+               "  -render-trace <file>        like -render, also write every render command to the file\n"
+               "  -render-verify              like -render, also check that buffers match their face lists\n"
+               "  -grid-benchmark <count>     compare all pairs with spatial grid queries of synthetic rectangles,\n"
+               "                              measures the grid only, -shot-benchmark runs real shot updates\n"
+               "  -shot-benchmark <count>     fire the given number of shots and measure their update\n"
+               "  -sprite-benchmark <count>   add the given number of short lived sprites per tick\n"
+               "  -text-benchmark <count>     print the given number of changing strings per frame\n"
+               "  -json-benchmark <count>     parse every level the given number of times with each JSON parser\n"
+               "  -parallel <games>           simulate the game several times serially and on threads, compare results\n");
+    }
+
+    void HeadlessApplication::parseArguments(Int32 argc, char **argv) {
+        for (Int32 i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            bool hasValue = i + 1 < argc;
+
+            if (arg == "-quick-liquid") {
+                gameSettings.setQuickLiquid(true);
+            } else if (arg == "-render") {
+                renderFrames = true;
+            } else if (arg == "-render-verify") {
+                renderFrames = true;
+                verifyBuffers = true;
+            } else if (!hasValue) {
+                D6_THROW(GameException, Format("Missing value of command line argument {0}") << arg);
+            } else if (arg == "-player") {
+                std::string value = argv[++i];
+                auto separator = value.find(':');
+                if (separator == std::string::npos) {
+                    playerArguments.push_back({value, value});
+                } else {
+                    playerArguments.push_back({value.substr(0, separator), value.substr(separator + 1)});
+                }
+            } else if (arg == "-level") {
+                levels.push_back(argv[++i]);
+            } else if (arg == "-rounds") {
+                gameSettings.setMaxRounds(std::max(1, std::stoi(argv[++i])));
+            } else if (arg == "-mode") {
+                gameModeIndex = std::stoul(argv[++i]);
+            } else if (arg == "-ticks") {
+                maxTicks = std::stoull(argv[++i]);
+            } else if (arg == "-jobs") {
+                jobWorkers = std::stoul(argv[++i]);
+            } else if (arg == "-shot-collision") {
+                Size collision = std::min(2ul, std::stoul(argv[++i]));
+                gameSettings.setShotCollision(ShotCollisionSetting(collision));
+            } else if (arg == "-seed") {
+                gameSettings.setDeterministic(true).setSeed(Uint32(std::stoul(argv[++i])));
+            } else if (arg == "-record") {
+                recordPath = argv[++i];
+            } else if (arg == "-render-trace") {
+                renderFrames = true;
+                renderTracePath = argv[++i];
+            } else if (arg == "-grid-benchmark") {
+                benchmarkGridRects = std::stoul(argv[++i]);
+            } else if (arg == "-shot-benchmark") {
+                benchmarkPlayerShots = std::stoul(argv[++i]);
+            } else if (arg == "-sprite-benchmark") {
+                benchmarkSprites = std::stoul(argv[++i]);
+            } else if (arg == "-text-benchmark") {
+                benchmarkTexts = std::stoul(argv[++i]);
+            } else if (arg == "-json-benchmark") {
+                benchmarkJson = std::max(1ul, std::stoul(argv[++i]));
+            } else if (arg == "-parallel") {
+                parallelGames = std::max(1ul, std::stoul(argv[++i]));
+            } else if (arg == "-replay") {
+                loadReplay(argv[++i]);
+            } else {
+                printUsage();
+                D6_THROW(GameException, Format("Unknown command line argument {0}") << arg);
+            }
+        }
+
+        if (benchmarkGridRects > 0 || benchmarkSprites > 0 || benchmarkTexts > 0 || benchmarkJson > 0) {
+            return;
+        }
+
+        if (playerArguments.size() < 2 || playerArguments.size() > D6_MAX_PLAYERS) {
+            printUsage();
+            D6_THROW(GameException, Format("Between 2 and {0} players are required") << D6_MAX_PLAYERS);
+        }
+
+        if (gameModeIndex >= gameModes.size()) {
+            D6_THROW(GameException, Format("Invalid game mode index {0}") << gameModeIndex);
+        }
+
+        if (levels.empty()) {
+            LevelList levelList;
+            levelList.initialize(D6_FILE_LEVEL, D6_LEVEL_EXTENSION);
+            for (Size i = 0; i < levelList.getLength(); i++) {
+                levels.push_back(levelList.getPath(i));
+            }
+        }
+
+        for (const std::string &level : levels) {
+            if (!File::exists(level)) {
+                D6_THROW(GameException, Format("Level {0} does not exist") << level);
+            }
+        }
+    }
+
+    void HeadlessApplication::loadReplay(const std::string &path) {
+        replay = std::make_unique<Replay>(Replay::load(path));
+
+        // Recorded inputs replace controls and scripts, the players only need names
+        playerArguments.clear();
+        for (const std::string &name : replay->getPlayerNames()) {
+            playerArguments.push_back({name, ""});
+        }
+
+        levels.clear();
+        for (const Replay::Round &round : replay->getRounds()) {
+            levels.push_back(round.getLevel());
+        }
+
+        auto mode = std::find_if(gameModes.begin(), gameModes.end(), [this](const std::unique_ptr<GameMode> &mode) {
+            return mode->getName() == replay->getGameMode();
+        });
+        if (mode == gameModes.end()) {
+            D6_THROW(GameException, Format("Unknown game mode {0} in replay {1}") << replay->getGameMode() << path);
+        }
+        gameModeIndex = Size(mode - gameModes.begin());
+    }
+
+    void HeadlessApplication::loadPersonProfiles(const std::string &path) {
+        console.printLine("\n===Person profile initialization===");
+
+        for (const PlayerArgument &player : playerArguments) {
+            if (player.profile.empty() || personProfiles.find(player.profile) != personProfiles.end()) {
+                continue;
+            }
+
+            std::string profilePath = Format("{0}/{1}/") << path << player.profile;
+            if (!File::exists(profilePath + D6_FILE_PROFILE_SKIN)) {
+                console.printLine(Format("...No profile for player {0}, the player stays idle") << player.name);
+                continue;
+            }
+
+            auto profile = std::make_unique<PersonProfile>(player.profile, profilePath);
+            profile->loadSounds(sound);
+            profile->loadSkinColors();
+            profile->loadScripts(scriptManager);
+            personProfiles.insert(std::make_pair(player.profile, std::move(profile)));
+        }
+    }
+
+    PersonProfile *HeadlessApplication::getPersonProfile(const std::string &name) {
+        auto profile = personProfiles.find(name);
+        if (profile != personProfiles.end()) {
+            return profile->second.get();
+        }
+
+        return nullptr;
+    }
+
+    std::vector<Game::PlayerDefinition> HeadlessApplication::createPlayerDefinitions(const PlayerSounds &defaultSounds) {
+        // Players keep references to persons so the storage must not reallocate
+        persons.clear();
+        persons.reserve(playerArguments.size());
+
+        std::vector<Game::PlayerDefinition> playerDefinitions;
+        for (Size i = 0; i < playerArguments.size(); i++) {
+            PersonProfile *profile = getPersonProfile(playerArguments[i].profile);
+            persons.emplace_back(playerArguments[i].name, profile);
+
+            // Keyboard controls are never pressed without input events, only scripts move the players
+            const PlayerControls &controls = controlsManager.get(i % controlsManager.getNumAvailable());
+            PlayerSkinColors colors = profile ? profile->getSkinColors() : PlayerSkinColors::makeRandom();
+            const PlayerSounds &sounds = profile ? profile->getSounds() : defaultSounds;
+            playerDefinitions.push_back(Game::PlayerDefinition(persons.back(), colors, sounds, controls));
+        }
+
+        return playerDefinitions;
+    }
+
+    void HeadlessApplication::run() {
+        if (benchmarkGridRects > 0) {
+            runGridBenchmark();
+            return;
+        }
+
+        if (benchmarkSprites > 0) {
+            runSpriteBenchmark();
+            return;
+        }
+
+        if (benchmarkTexts > 0) {
+            runTextBenchmark();
+            return;
+        }
+
+        if (benchmarkJson > 0) {
+            runJsonBenchmark();
+            return;
+        }
+
+        if (parallelGames > 0) {
+            runParallelTest();
+            return;
+        }
+
+        PlayerSounds defaultSounds = PlayerSounds::makeDefault(sound);
+        std::vector<Game::PlayerDefinition> playerDefinitions = createPlayerDefinitions(defaultSounds);
+        GameMode &gameMode = *gameModes[gameModeIndex];
+        gameMode.initializePlayers(playerDefinitions);
+
+        std::vector<Size> backgrounds;
+        for (Size i = 0; i < gameResources.getBcgTextures().getTextures().size(); i++) {
+            backgrounds.push_back(i);
+        }
+
+        game->start(playerDefinitions, levels, backgrounds, ScreenMode::FullScreen, 13, gameMode);
+
+        if (benchmarkPlayerShots > 0) {
+            runShotBenchmark();
+            return;
+        }
+
+        Uint64 ticks = 0;
+        Float64 renderSeconds = 0;
+        auto startTime = std::chrono::steady_clock::now();
+        while (!game->isOver() && (maxTicks == 0 || ticks < maxTicks)) {
+            game->update(Float32(updateTime));
+            ticks++;
+
+            if (renderFrames) {
+                auto renderStartTime = std::chrono::steady_clock::now();
+                game->render(1.0f);
+                video->getRenderer().flush();
+                renderSeconds += std::chrono::duration<Float64>(std::chrono::steady_clock::now() - renderStartTime).count();
+            }
+        }
+        auto endTime = std::chrono::steady_clock::now();
+
+        printResults(ticks, std::chrono::duration<Float64>(endTime - startTime).count() - renderSeconds);
+
+        if (renderFrames) {
+            printRenderStats(renderSeconds);
+            Uint64 staleFaces = static_cast<const NullRenderer &>(video->getRenderer()).getStats().staleFaces;
+            if (staleFaces > 0) {
+                D6_THROW(GameException, Format("Buffers of {0} drawn faces differ from their face lists") << staleFaces);
+            }
+        }
+
+        if (replay) {
+            Size keyframes = 0;
+            for (const Replay::Round &round : replay->getRounds()) {
+                keyframes += round.getKeyframes().size();
+            }
+            console.printLine(Format("...Replay verified: {0} ticks, {1} keyframes") << replay->getTicks() << keyframes);
+        }
+
+        if (!recordPath.empty()) {
+            game->getReplay().save(recordPath);
+            console.printLine(Format("...Replay saved to {0}") << recordPath);
+        }
+    }
+
+    namespace {
+        struct GridBenchmarkRect {
+            Vector position;
+            Vector velocity;
+            SpatialGridCells cells;
+
+            Rectangle getCollisionRect() const {
+                return Rectangle::fromCornerAndSize(position, Vector(0.3f, 0.2f));
+            }
+
+            void move(Float32 elapsedTime, Float32 width, Float32 height) {
+                position += velocity * elapsedTime;
+                if (position.x < 0 || position.x > width) {
+                    velocity.x = -velocity.x;
+                }
+                if (position.y < 0 || position.y > height) {
+                    velocity.y = -velocity.y;
+                }
+            }
+        };
+    }
+
+    void HeadlessApplication::runGridBenchmark() {
+        // Measures the spatial grid on its own, the rectangles are not shots and ShotList::update is never run
+        const Int32 width = 64;
+        const Int32 height = 48;
+        const Uint64 ticks = maxTicks > 0 ? maxTicks : 10 * D6_UPDATE_FREQUENCY;
+
+        Math::RandomEngine randomEngine(1);
+        Math::RandomScope randomScope(randomEngine);
+        std::vector<GridBenchmarkRect> initialRects(benchmarkGridRects);
+        for (GridBenchmarkRect &rect : initialRects) {
+            rect.position = Vector(Math::random(0.0f, Float32(width)), Math::random(0.0f, Float32(height)));
+            rect.velocity = Vector(Math::random(-15.0f, 15.0f), Math::random(-15.0f, 15.0f));
+        }
+
+        // Test of all pairs as done before the broadphase existed
+        std::vector<GridBenchmarkRect> rects = initialRects;
+        Uint64 brutePairs = 0;
+        auto startTime = std::chrono::steady_clock::now();
+        for (Uint64 tick = 0; tick < ticks; tick++) {
+            for (GridBenchmarkRect &rect : rects) {
+                rect.move(Float32(updateTime), width, height);
+            }
+            for (const GridBenchmarkRect &rect : rects) {
+                for (const GridBenchmarkRect &otherRect : rects) {
+                    if (&rect != &otherRect &&
+                        Collision::rectangles(rect.getCollisionRect(), otherRect.getCollisionRect())) {
+                        brutePairs++;
+                    }
+                }
+            }
+        }
+        Float64 bruteSeconds = std::chrono::duration<Float64>(std::chrono::steady_clock::now() - startTime).count();
+
+        rects = initialRects;
+        SpatialGrid<GridBenchmarkRect> grid(width, height, ShotList::GRID_CELL_SIZE);
+        std::vector<GridBenchmarkRect *> candidates;
+        Uint64 gridPairs = 0;
+        startTime = std::chrono::steady_clock::now();
+        for (Uint64 tick = 0; tick < ticks; tick++) {
+            for (GridBenchmarkRect &rect : rects) {
+                rect.move(Float32(updateTime), width, height);
+                grid.remove(&rect, rect.cells);
+                rect.cells = grid.getCells(rect.getCollisionRect());
+                grid.insert(&rect, rect.cells);
+            }
+            for (GridBenchmarkRect &rect : rects) {
+                const Rectangle bounds = rect.getCollisionRect();
+                candidates.clear();
+                grid.query(grid.getCells(bounds), candidates);
+                std::sort(candidates.begin(), candidates.end());
+                candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+                for (const GridBenchmarkRect *otherRect : candidates) {
+                    if (&rect != otherRect && Collision::rectangles(bounds, otherRect->getCollisionRect())) {
+                        gridPairs++;
+                    }
+                }
+            }
+        }
+        Float64 gridSeconds = std::chrono::duration<Float64>(std::chrono::steady_clock::now() - startTime).count();
+
+        console.printLine("\n===Spatial grid benchmark===");
+        console.printLine(Format("...Rectangles: {0}") << benchmarkGridRects);
+        console.printLine(Format("...Ticks: {0}") << ticks);
+        console.printLine(Format("...Overlapping pairs: all pairs {0}, grid {1}") << brutePairs << gridPairs);
+        console.printLine(Format("...All pairs: {0} ms/tick") << (bruteSeconds * 1000 / ticks));
+        console.printLine(Format("...Grid: {0} ms/tick") << (gridSeconds * 1000 / ticks));
+        console.printLine(Format("...Speed-up: {0}x") << (gridSeconds > 0 ? bruteSeconds / gridSeconds : 0));
+
+        if (brutePairs != gridPairs) {
+            D6_THROW(GameException, "Spatial grid query results differ from testing all pairs");
+        }
+    }
+
+    void HeadlessApplication::runShotBenchmark() {
+        const Uint64 ticks = maxTicks > 0 ? maxTicks : 20;
+        World &world = game->getRound().getWorld();
+        std::vector<Player> &players = world.getPlayers();
+        const std::vector<Weapon> &weapons = Weapon::values();
+
+        // Shot collisions stay as configured, large shots fired from the same spot destroy each other on the first
+        // update the same way they would in a game
+        const char *collisionNames[] = {"none", "large", "all"};
+
+        auto startTime = std::chrono::steady_clock::now();
+        for (Size i = 0; i < benchmarkPlayerShots; i++) {
+            Orientation orientation = (i % 2 == 0) ? Orientation::Left : Orientation::Right;
+            weapons[i % weapons.size()].shoot(players[i % players.size()], orientation, world);
+        }
+        Float64 fireSeconds = std::chrono::duration<Float64>(std::chrono::steady_clock::now() - startTime).count();
+
+        Uint64 updatedShots = 0;
+        Float64 updateSeconds = 0;
+        for (Uint64 tick = 0; tick < ticks; tick++) {
+            world.getShotList().forEach([&updatedShots](const Shot &shot) {
+                updatedShots++;
+                return true;
+            });
+            startTime = std::chrono::steady_clock::now();
+            world.getShotList().update(world, Float32(updateTime));
+            updateSeconds += std::chrono::duration<Float64>(std::chrono::steady_clock::now() - startTime).count();
+        }
+
+        console.printLine("\n===Shot benchmark===");
+        console.printLine(Format("...Shots fired: {0}") << benchmarkPlayerShots);
+        console.printLine(Format("...Ticks: {0}") << ticks);
+        console.printLine(Format("...Shot collision: {0}") << collisionNames[Size(gameSettings.getShotCollision())]);
+        console.printLine(Format("...Shot updates: {0}") << updatedShots);
+        console.printLine(Format("...Fire: {0} ns/shot") << (fireSeconds * 1e9 / benchmarkPlayerShots));
+        console.printLine(Format("...Update: {0} ns/shot") << (updatedShots > 0 ? updateSeconds * 1e9 / updatedShots : 0));
+    }
+
+    void HeadlessApplication::runSpriteBenchmark() {
+        const Uint64 ticks = maxTicks > 0 ? maxTicks : 10 * D6_UPDATE_FREQUENCY;
+        const AnimationEntry animation[] = {0, 50, 1, 50, 2, 50, -1, 0};
+        Renderer &renderer = video->getRenderer();
+        SpriteList spriteList;
+        SpriteList::Snapshot snapshot;
+
+        // Blood and explosions: a quarter of the sprites is blended, all of them remove themselves
+        Math::RandomEngine randomEngine(1);
+        Math::RandomScope randomScope(randomEngine);
+        Size liveSprites = 0;
+        Float64 addSeconds = 0;
+        Float64 updateSeconds = 0;
+        Float64 snapshotSeconds = 0;
+        Float64 renderSeconds = 0;
+        for (Uint64 tick = 0; tick < ticks; tick++) {
+            auto startTime = std::chrono::steady_clock::now();
+            for (Size i = 0; i < benchmarkSprites; i++) {
+                auto sprite = spriteList.add(animation, Texture());
+                sprite->setPosition(Vector(Math::random(0.0f, 64.0f), Math::random(0.0f, 48.0f)), 0.5f)
+                        .setLooping(AnimationLooping::OnceAndRemove);
+                if (i % 4 == 0) {
+                    sprite->setAlpha(0.5f);
+                }
+            }
+            auto addTime = std::chrono::steady_clock::now();
+            spriteList.update(Float32(updateTime));
+            spriteList.compact();
+            auto updateEndTime = std::chrono::steady_clock::now();
+            spriteList.snapshot(snapshot);
+            auto snapshotEndTime = std::chrono::steady_clock::now();
+            SpriteList::render(renderer, snapshot, 1.0f);
+            auto renderEndTime = std::chrono::steady_clock::now();
+
+            addSeconds += std::chrono::duration<Float64>(addTime - startTime).count();
+            updateSeconds += std::chrono::duration<Float64>(updateEndTime - addTime).count();
+            snapshotSeconds += std::chrono::duration<Float64>(snapshotEndTime - updateEndTime).count();
+            renderSeconds += std::chrono::duration<Float64>(renderEndTime - snapshotEndTime).count();
+            liveSprites += spriteList.size();
+        }
+
+        console.printLine("\n===Sprite benchmark===");
+        console.printLine(Format("...Sprites per tick: {0}") << benchmarkSprites);
+        console.printLine(Format("...Ticks: {0}") << ticks);
+        console.printLine(Format("...Average live sprites: {0}") << (liveSprites / ticks));
+        console.printLine(Format("...Add: {0} ns/sprite") << (addSeconds * 1e9 / (benchmarkSprites * ticks)));
+        console.printLine(Format("...Update: {0} ns/sprite") << (updateSeconds * 1e9 / liveSprites));
+        console.printLine(Format("...Snapshot: {0} ns/sprite") << (snapshotSeconds * 1e9 / liveSprites));
+        console.printLine(Format("...Render: {0} ns/sprite") << (renderSeconds * 1e9 / liveSprites));
+    }
+
+    void HeadlessApplication::runTextBenchmark() {
+        const Uint64 frames = maxTicks > 0 ? maxTicks : 100;
+        if (TTF_Init() != 0) {
+            D6_THROW(FontException, Format("Unable to initialize font subsystem: {0}") << TTF_GetError());
+        }
+
+        Float64 warmUpSeconds = 0;
+        Float64 printSeconds = 0;
+        Size characters = 0;
+        Uint64 frameTextures = 0;
+        {
+            console.printLine("\n===Text benchmark===");
+            auto loadStartTime = std::chrono::steady_clock::now();
+            Font textFont(video->getRenderer());
+            textFont.load(D6_FILE_TTF_FONT, console);
+            warmUpSeconds = std::chrono::duration<Float64>(std::chrono::steady_clock::now() - loadStartTime).count();
+
+            // Ammo counts, scores and timers: every frame prints strings it did not print before,
+            // player names may contain Latin-1 characters
+            const NullRenderer &nullRenderer = static_cast<const NullRenderer &>(video->getRenderer());
+            Uint64 warmUpTextures = 0;
+            std::vector<std::string> texts(benchmarkTexts);
+            for (Uint64 frame = 0; frame < frames; frame++) {
+                for (Size i = 0; i < benchmarkTexts; i++) {
+                    texts[i] = Format("Pl\xE1yer {0}: {1} kills {2}") << i << frame << (frame * benchmarkTexts + i);
+                    characters += texts[i].size();
+                }
+
+                auto startTime = std::chrono::steady_clock::now();
+                for (Size i = 0; i < benchmarkTexts; i++) {
+                    textFont.print(Float32(i % 80), Float32(i / 80), 0.0f, Color::WHITE, texts[i], 16.0f);
+                }
+                printSeconds += std::chrono::duration<Float64>(std::chrono::steady_clock::now() - startTime).count();
+
+                if (frame == 0) {
+                    warmUpTextures = nullRenderer.getStats().texturesCreated;
+                }
+            }
+
+            frameTextures = nullRenderer.getStats().texturesCreated - warmUpTextures;
+        }
+        TTF_Quit();
+
+        if (frameTextures > 0) {
+            D6_THROW(GameException, Format("Printing text created {0} textures after the warm-up") << frameTextures);
+        }
+
+        console.printLine(Format("...Strings per frame: {0}") << benchmarkTexts);
+        console.printLine(Format("...Frames: {0}") << frames);
+        console.printLine(Format("...Atlas: {0} ms") << (warmUpSeconds * 1e3));
+        console.printLine(Format("...Print: {0} ms/frame") << (printSeconds * 1e3 / frames));
+        console.printLine(Format("...Print: {0} ns/string, {1} ns/character")
+                          << (printSeconds * 1e9 / (benchmarkTexts * frames)) << (printSeconds * 1e9 / characters));
+    }
+
+    void HeadlessApplication::runJsonBenchmark() {
+        std::vector<std::string> files = File::listDirectory(D6_FILE_LEVEL, D6_LEVEL_EXTENSION);
+        std::sort(files.begin(), files.end());
+        Json::StreamParser streamParser;
+        Json::Parser parser;
+        Json::Writer writer(false);
+
+        Size bytes = 0;
+        Float64 streamSeconds = 0;
+        Float64 bufferSeconds = 0;
+        Float64 documentSeconds = 0;
+        for (const std::string &file : files) {
+            std::string path = D6_FILE_LEVEL + file;
+            bytes += File::getSize(path);
+
+            Json::Value streamValue;
+            auto startTime = std::chrono::steady_clock::now();
+            for (Size i = 0; i < benchmarkJson; i++) {
+                streamValue = streamParser.parse(path);
+            }
+            auto streamEndTime = std::chrono::steady_clock::now();
+            Json::Value bufferValue;
+            for (Size i = 0; i < benchmarkJson; i++) {
+                bufferValue = parser.parse(path);
+            }
+            auto bufferEndTime = std::chrono::steady_clock::now();
+            Json::Document document;
+            for (Size i = 0; i < benchmarkJson; i++) {
+                document = parser.parseDocument(path);
+            }
+            auto documentEndTime = std::chrono::steady_clock::now();
+
+            streamSeconds += std::chrono::duration<Float64>(streamEndTime - startTime).count();
+            bufferSeconds += std::chrono::duration<Float64>(bufferEndTime - streamEndTime).count();
+            documentSeconds += std::chrono::duration<Float64>(documentEndTime - bufferEndTime).count();
+
+            std::string streamJson = writer.writeToString(streamValue);
+            if (streamJson != writer.writeToString(bufferValue) ||
+                streamJson != writer.writeToString(document.getRoot().toValue())) {
+                D6_THROW(GameException, Format("Parsers read different values from {0}") << path);
+            }
+        }
+
+        Float64 megabytes = Float64(bytes) * benchmarkJson / (1024 * 1024);
+        console.printLine("\n===JSON benchmark===");
+        console.printLine(Format("...Files: {0} ({1} bytes)") << files.size() << bytes);
+        console.printLine(Format("...Repeats: {0}") << benchmarkJson);
+        console.printLine(Format("...Stream parser: {0} ms/file, {1} MB/s")
+                          << (streamSeconds * 1e3 / (files.size() * benchmarkJson)) << (megabytes / streamSeconds));
+        console.printLine(Format("...Buffered parser: {0} ms/file, {1} MB/s")
+                          << (bufferSeconds * 1e3 / (files.size() * benchmarkJson)) << (megabytes / bufferSeconds));
+        console.printLine(Format("...Document: {0} ms/file, {1} MB/s")
+                          << (documentSeconds * 1e3 / (files.size() * benchmarkJson)) << (megabytes / documentSeconds));
+        console.printLine(Format("...Speed-up: {0}x, document {1}x")
+                          << (bufferSeconds > 0 ? streamSeconds / bufferSeconds : 0)
+                          << (documentSeconds > 0 ? streamSeconds / documentSeconds : 0));
+    }
+
+    Replay HeadlessApplication::makeRandomInputs() const {
+        Replay inputs;
+        inputs.setSettings(gameModes[gameModeIndex]->getName(), gameSettings);
+        for (const PlayerArgument &player : playerArguments) {
+            inputs.addPlayer(player.name);
+        }
+
+        // Players hold a random combination of buttons and change it from time to time
+        Math::RandomEngine randomEngine(gameSettings.getSeed());
+        for (Int32 i = 0; i < gameSettings.getMaxRounds(); i++) {
+            Replay::Round &round = inputs.addRound(Uint32(randomEngine()), levels[i % levels.size()], i % 2 == 1);
+            Uint64 ticks = maxTicks > 0 ? maxTicks : (30 + randomEngine() % 31) * D6_UPDATE_FREQUENCY;
+            std::vector<Uint32> controllerStates(playerArguments.size(), 0);
+            for (Uint64 tick = 0; tick < ticks; tick++) {
+                for (Uint32 &controllerState : controllerStates) {
+                    if (randomEngine() % 16 == 0) {
+                        controllerState = Uint32(randomEngine()) & 0x3f;
+                    }
+                    round.addInput(controllerState);
+                }
+            }
+        }
+
+        return inputs;
+    }
+
+    std::unique_ptr<HeadlessApplication::Simulation> HeadlessApplication::startSimulation(const Replay &inputs,
+                                                                                        const PlayerSounds &defaultSounds) {
+        auto simulation = std::make_unique<Simulation>();
+        simulation->settings = gameSettings;
+        inputs.applySettings(simulation->settings);
+        simulation->service = std::make_unique<AppService>(*font, simulation->console, *textureManager, *video, input,
+                                                           controlsManager, sound, scriptManager, *jobSystem);
+
+        addGameModes(simulation->gameModes);
+        auto mode = std::find_if(simulation->gameModes.begin(), simulation->gameModes.end(),
+                                 [&inputs](const std::unique_ptr<GameMode> &mode) {
+                                     return mode->getName() == inputs.getGameMode();
+                                 });
+        if (mode == simulation->gameModes.end()) {
+            D6_THROW(GameException, Format("Unknown game mode {0}") << inputs.getGameMode());
+        }
+
+        // Scripts share one Lua state, the players are driven by the recorded inputs only
+        std::vector<Game::PlayerDefinition> playerDefinitions;
+        simulation->persons.reserve(inputs.getPlayerNames().size());
+        for (Size i = 0; i < inputs.getPlayerNames().size(); i++) {
+            simulation->persons.emplace_back(inputs.getPlayerNames()[i], nullptr);
+            const PlayerControls &controls = controlsManager.get(i % controlsManager.getNumAvailable());
+            playerDefinitions.push_back(Game::PlayerDefinition(simulation->persons.back(),
+                                                               PlayerSkinColors::makeRandom(), defaultSounds,
+                                                               controls));
+        }
+        (*mode)->initializePlayers(playerDefinitions);
+
+        std::vector<std::string> roundLevels;
+        for (const Replay::Round &round : inputs.getRounds()) {
+            roundLevels.push_back(round.getLevel());
+        }
+        std::vector<Size> backgrounds;
+        for (Size i = 0; i < gameResources.getBcgTextures().getTextures().size(); i++) {
+            backgrounds.push_back(i);
+        }
+
+        simulation->game = std::make_unique<Game>(*simulation->service, gameResources, simulation->settings);
+        simulation->game->setReplayPlayback(&inputs);
+        simulation->game->start(playerDefinitions, roundLevels, backgrounds, ScreenMode::FullScreen, 13, **mode);
+        return simulation;
+    }
+
+    void HeadlessApplication::simulate(Simulation &simulation) {
+        // FNV-1a over the world checksum of every tick, any divergence changes the trace
+        const Uint64 prime = 1099511628211ull;
+        Game &game = *simulation.game;
+        simulation.trace = 14695981039346656037ull;
+        while (!game.isOver()) {
+            game.update(Float32(updateTime));
+            simulation.ticks++;
+            simulation.trace = (simulation.trace ^ Replay::checksum(game.getRound().getWorld())) * prime;
+        }
+
+        for (const Player &player : game.getPlayers()) {
+            const Person &person = player.getPerson();
+            for (Int32 value : {person.getTotalPoints(), person.getKills(), person.getDeaths(), person.getShots()}) {
+                simulation.trace = (simulation.trace ^ Uint32(value)) * prime;
+            }
+        }
+    }
+
+    void HeadlessApplication::runParallelTest() {
+        Replay inputs = replay ? *replay : makeRandomInputs();
+        PlayerSounds defaultSounds = PlayerSounds::makeDefault(sound);
+
+        // Games are started serially as player skins are created through the shared texture manager
+        std::vector<std::unique_ptr<Simulation>> serial;
+        std::vector<std::unique_ptr<Simulation>> parallel;
+        for (Size i = 0; i < parallelGames; i++) {
+            serial.push_back(startSimulation(inputs, defaultSounds));
+            parallel.push_back(startSimulation(inputs, defaultSounds));
+        }
+
+        auto startTime = std::chrono::steady_clock::now();
+        for (auto &simulation : serial) {
+            simulate(*simulation);
+        }
+        Float64 serialSeconds = std::chrono::duration<Float64>(std::chrono::steady_clock::now() - startTime).count();
+
+        std::vector<std::thread> threads;
+        std::vector<std::exception_ptr> errors(parallelGames);
+        startTime = std::chrono::steady_clock::now();
+        for (Size i = 0; i < parallelGames; i++) {
+            threads.emplace_back([&parallel, &errors, i]() {
+                try {
+                    simulate(*parallel[i]);
+                } catch (...) {
+                    errors[i] = std::current_exception();
+                }
+            });
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+        Float64 parallelSeconds = std::chrono::duration<Float64>(std::chrono::steady_clock::now() - startTime).count();
+
+        for (const std::exception_ptr &error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        console.printLine("\n===Parallel simulation===");
+        console.printLine(Format("...Games: {0}") << parallelGames);
+        console.printLine(Format("...Hardware threads: {0}") << std::thread::hardware_concurrency());
+        console.printLine(Format("...Ticks per game: {0}") << serial[0]->ticks);
+        console.printLine(Format("...Serial: {0} s") << serialSeconds);
+        console.printLine(Format("...Parallel: {0} s") << parallelSeconds);
+        console.printLine(Format("...Speed-up: {0}x") << (parallelSeconds > 0 ? serialSeconds / parallelSeconds : 0));
+
+        for (Size i = 0; i < parallelGames; i++) {
+            for (const Simulation *simulation : {serial[i].get(), parallel[i].get()}) {
+                if (simulation->ticks != serial[0]->ticks || simulation->trace != serial[0]->trace) {
+                    D6_THROW(GameException, Format("Simulation {0} diverged from the first one") << i);
+                }
+            }
+        }
+        console.printLine("...All simulations are identical");
+    }
+
+    void HeadlessApplication::printResults(Uint64 ticks, Float64 elapsedSeconds) {
+        Float64 simulatedSeconds = ticks * updateTime;
+        Float64 ticksPerSecond = elapsedSeconds > 0 ? ticks / elapsedSeconds : 0;
+
+        console.printLine("\n===Headless results===");
+        console.printLine(Format("...Mode: {0}") << game->getMode().getName());
+        console.printLine(Format("...Rounds played: {0}") << game->getPlayedRounds());
+        console.printLine(Format("...Ticks: {0}") << ticks);
+        console.printLine(Format("...Simulated time: {0} s") << simulatedSeconds);
+        console.printLine(Format("...Wall time: {0} s") << elapsedSeconds);
+        console.printLine(Format("...Ticks/second: {0}") << Int32(ticksPerSecond));
+        console.printLine(Format("...Speed-up: {0}x") << Int32(ticksPerSecond / D6_UPDATE_FREQUENCY));
+
+        console.printLine(Format("\n{0,-16}{1,8}{2,8}{3,8}{4,8}{5,8}{6,10}")
+                                  << "Player" << "Points" << "Wins" << "Kills" << "Deaths" << "Shots" << "Accuracy");
+        for (const Player &player : game->getPlayers()) {
+            const Person &person = player.getPerson();
+            console.printLine(Format("{0,-16}{1,8}{2,8}{3,8}{4,8}{5,8}{6,9}%")
+                                      << person.getName() << person.getTotalPoints() << person.getWins()
+                                      << person.getKills() << person.getDeaths() << person.getShots()
+                                      << person.getAccuracy());
+        }
+    }
+
+    void HeadlessApplication::printRenderStats(Float64 renderSeconds) {
+        const NullRenderer &renderer = static_cast<const NullRenderer &>(video->getRenderer());
+        const NullRenderer::Stats &stats = renderer.getStats();
+        Float64 frames = Float64(std::max(stats.frames, Uint64(1)));
+
+        console.printLine("\n===Render statistics===");
+        console.printLine(Format("...Frames: {0}") << stats.frames);
+        console.printLine(Format("...Render: {0} ms/frame") << (renderSeconds * 1e3 / frames));
+        console.printLine(Format("...Draw calls: {0}/frame") << (stats.drawCalls / frames));
+        console.printLine(Format("...Vertices: {0}/frame") << (stats.vertices / frames));
+        console.printLine(Format("...Texture binds: {0}/frame") << (stats.textureBinds / frames));
+        console.printLine(Format("...Blend changes: {0}/frame") << (stats.blendChanges / frames));
+        console.printLine(Format("...Depth changes: {0}/frame") << (stats.depthChanges / frames));
+        console.printLine(Format("...State changes: {0}/frame") << (renderer.getStateChanges() / frames));
+        console.printLine(Format("...Buffers: {0} created, {1} uploads, {2} vertices uploaded")
+                          << stats.buffersCreated << stats.bufferUploads << stats.uploadedVertices);
+        console.printLine(Format("...Textures created: {0}") << stats.texturesCreated);
+        if (verifyBuffers) {
+            console.printLine(Format("...Stale buffer faces: {0}") << stats.staleFaces);
+        }
+        if (!renderTracePath.empty()) {
+            console.printLine(Format("...Trace saved to {0}") << renderTracePath);
+        }
+    }
+}
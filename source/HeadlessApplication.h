@@ -0,0 +1,144 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef DUEL6_HEADLESSAPPLICATION_H
+#define DUEL6_HEADLESSAPPLICATION_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "AppService.h"
+#include "Game.h"
+#include "GameMode.h"
+#include "Person.h"
+#include "PersonProfile.h"
+#include "Replay.h"
+#include "Video.h"
+#include "script/ScriptManager.h"
+
+namespace Duel6 {
+    /** Runs game rounds without a window, audio device or rendering, as fast as the CPU allows */
+    class HeadlessApplication {
+    private:
+        struct PlayerArgument {
+            std::string name;
+            std::string profile;
+        };
+
+        /** Game with its own console, settings and players, independent of all other simulated games */
+        struct Simulation {
+            Console console;
+            GameSettings settings;
+            std::unique_ptr<AppService> service;
+            std::vector<std::unique_ptr<GameMode>> gameModes;
+            std::vector<Person> persons;
+            std::unique_ptr<Game> game;
+            Uint64 ticks;
+            Uint64 trace;
+
+            Simulation()
+                    : console(0), ticks(0), trace(0) {}
+        };
+
+    private:
+        Console console;
+        Input input;
+        PlayerControlsManager controlsManager;
+        Sound sound;
+        GameSettings gameSettings;
+        GameResources gameResources;
+        Script::ScriptContext scriptContext;
+        Script::ScriptManager scriptManager;
+        std::unique_ptr<Video> video;
+        std::unique_ptr<Font> font;
+        std::unique_ptr<TextureManager> textureManager;
+        std::unique_ptr<JobSystem> jobSystem;
+        std::unique_ptr<AppService> service;
+        std::unique_ptr<Game> game;
+        std::vector<std::unique_ptr<GameMode>> gameModes;
+        PersonProfileList personProfiles;
+        std::vector<Person> persons;
+        std::vector<std::string> levels;
+        std::vector<PlayerArgument> playerArguments;
+        Size gameModeIndex;
+        Uint64 maxTicks;
+        Size benchmarkGridRects;
+        Size benchmarkPlayerShots;
+        Size benchmarkSprites;
+        Size benchmarkTexts;
+        Size benchmarkJson;
+        Size parallelGames;
+        Size jobWorkers;
+        bool renderFrames;
+        bool verifyBuffers;
+        std::string renderTracePath;
+        std::string recordPath;
+        std::unique_ptr<Replay> replay;
+
+    public:
+        HeadlessApplication(Int32 argc, char **argv);
+
+        void run();
+
+        static void printUsage();
+
+    private:
+        void parseArguments(Int32 argc, char **argv);
+
+        void loadReplay(const std::string &path);
+
+        void loadPersonProfiles(const std::string &path);
+
+        PersonProfile *getPersonProfile(const std::string &name);
+
+        std::vector<Game::PlayerDefinition> createPlayerDefinitions(const PlayerSounds &defaultSounds);
+
+        void runGridBenchmark();
+
+        void runShotBenchmark();
+
+        void runSpriteBenchmark();
+
+        void runTextBenchmark();
+
+        void runJsonBenchmark();
+
+        Replay makeRandomInputs() const;
+
+        std::unique_ptr<Simulation> startSimulation(const Replay &inputs, const PlayerSounds &defaultSounds);
+
+        void runParallelTest();
+
+        static void simulate(Simulation &simulation);
+
+        void printResults(Uint64 ticks, Float64 elapsedSeconds);
+
+        void printRenderStats(Float64 renderSeconds);
+    };
+}
+
+#endif
@@ -34,26 +34,37 @@
 namespace Duel6 {
     class InfoMessage {
     public:
+        // Owner of the message in the simulation, snapshots identify it by its index and name instead
         const Player *player;
+        Size playerIndex;
+        std::string playerName;
         std::string text;
         Float32 remainingTime;
 
     public:
         InfoMessage(const Player &player, const std::string &text, Float32 duration)
-                : player(&player), text(text), remainingTime(duration) {}
+                : player(&player), playerIndex(0), playerName(player.getPerson().getName()), text(text),
+                  remainingTime(duration) {}
 
         InfoMessage(const InfoMessage &msg)
-                : player(msg.player), text(msg.text), remainingTime(msg.remainingTime) {}
+                : player(msg.player), playerIndex(msg.playerIndex), playerName(msg.playerName), text(msg.text),
+                  remainingTime(msg.remainingTime) {}
 
         InfoMessage &operator=(const InfoMessage &msg) {
             player = msg.player;
+            playerIndex = msg.playerIndex;
+            playerName = msg.playerName;
             text = msg.text;
             remainingTime = msg.remainingTime;
             return *this;
         }
 
-        const Player &getPlayer() const {
-            return *player;
+        Size getPlayerIndex() const {
+            return playerIndex;
+        }
+
+        const std::string &getPlayerName() const {
+            return playerName;
         }
 
         const std::string &getText() const {
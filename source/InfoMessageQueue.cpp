@@ -46,13 +46,22 @@ namespace Duel6 {
         return *this;
     }
 
-    void InfoMessageQueue::renderPlayerMessages(Renderer &renderer, const Player &player, const Font &font) const {
-        const PlayerView &view = player.getView();
+    void InfoMessageQueue::snapshot(InfoMessageQueue &queue, const std::vector<Player> &players) const {
+        queue.duration = duration;
+        queue.messages = messages;
+        for (InfoMessage &msg : queue.messages) {
+            msg.playerIndex = Size(msg.player - players.data());
+            msg.player = nullptr;
+        }
+    }
+
+    void InfoMessageQueue::renderPlayerMessages(Renderer &renderer, Size playerIndex, const PlayerView &view,
+                                                const Font &font) const {
         Int32 posX = view.getX() + 4;
         Int32 posY = view.getY() + view.getHeight() - 24;
 
         for (const InfoMessage &msg : messages) {
-            if (player.is(msg.getPlayer())) {
+            if (msg.getPlayerIndex() == playerIndex) {
                 renderMessage(renderer, posX, posY, msg.getText(), font);
                 posY -= 16;
             }
@@ -64,7 +73,7 @@ namespace Duel6 {
         Int32 posY = view.getY() + view.getHeight() - offsetY;
 
         for (const InfoMessage &msg : messages) {
-            renderMessage(renderer, posX, posY, msg.getPlayer().getPerson().getName() + ": " + msg.getText(), font);
+            renderMessage(renderer, posX, posY, msg.getPlayerName() + ": " + msg.getText(), font);
             posY -= 16;
         }
     }
@@ -30,6 +30,7 @@
 
 #include <string>
 #include <list>
+#include <vector>
 #include "InfoMessage.h"
 
 namespace Duel6 {
@@ -47,7 +48,15 @@ namespace Duel6 {
 
         InfoMessageQueue &update(float elapsedTime);
 
-        void renderPlayerMessages(Renderer &renderer, const Player &player, const Font &font) const;
+        /**
+         * Copies the messages for rendering on another thread. Copies do not point to their players, they are
+         * identified by the index in the list of players.
+         */
+        void snapshot(InfoMessageQueue &queue, const std::vector<Player> &players) const;
+
+        /** Messages of the player with the given index are shown in the given view */
+        void renderPlayerMessages(Renderer &renderer, Size playerIndex, const PlayerView &view,
+                                  const Font &font) const;
 
         void renderAllMessages(Renderer &renderer, const PlayerView &view, Int32 offsetY, const Font &font) const;
 
@@ -0,0 +1,190 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include "JobSystem.h"
+
+namespace Duel6 {
+    namespace {
+        thread_local const JobSystem *currentSystem = nullptr;
+        thread_local Size currentQueue = 0;
+    }
+
+    JobSystem::Graph::Graph()
+            : unfinishedJobs(0), randomEngine(nullptr) {}
+
+    JobSystem::JobId JobSystem::Graph::add(const std::function<void()> &function) {
+        jobs.emplace_back(function, this);
+        return jobs.size() - 1;
+    }
+
+    JobSystem::Graph &JobSystem::Graph::after(JobId job, JobId prerequisite) {
+        jobs[prerequisite].dependents.push_back(&jobs[job]);
+        jobs[job].prerequisites++;
+        return *this;
+    }
+
+    JobSystem::JobSystem(Size workerCount)
+            : queuedJobs(0), stopping(false) {
+        for (Size i = 0; i <= workerCount; i++) {
+            queues.push_back(std::make_unique<Queue>());
+        }
+        for (Size i = 1; i <= workerCount; i++) {
+            workers.emplace_back(&JobSystem::workerLoop, this, i);
+        }
+    }
+
+    JobSystem::~JobSystem() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        wakeUp.notify_all();
+        for (std::thread &worker : workers) {
+            worker.join();
+        }
+    }
+
+    Size JobSystem::getDefaultWorkerCount() {
+        Size threads = std::thread::hardware_concurrency();
+        return threads > 1 ? threads - 1 : 0;
+    }
+
+    void JobSystem::run(Graph &graph) {
+        if (graph.jobs.empty()) {
+            return;
+        }
+
+        graph.randomEngine = &Math::getRandomEngine();
+        graph.error = nullptr;
+        graph.unfinishedJobs = graph.jobs.size();
+        for (Graph::Job &job : graph.jobs) {
+            job.waitingFor = job.prerequisites;
+        }
+        for (Graph::Job &job : graph.jobs) {
+            if (job.prerequisites == 0) {
+                push(&job);
+            }
+        }
+
+        // Help with any queued job, the jobs of this graph may have been stolen by workers
+        while (graph.unfinishedJobs.load(std::memory_order_acquire) > 0) {
+            Graph::Job *job = take();
+            if (job != nullptr) {
+                execute(job);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+
+        if (graph.error) {
+            std::rethrow_exception(graph.error);
+        }
+    }
+
+    void JobSystem::workerLoop(Size queueIndex) {
+        currentSystem = this;
+        currentQueue = queueIndex;
+
+        while (true) {
+            Graph::Job *job = take();
+            if (job != nullptr) {
+                execute(job);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wakeUp.wait(lock, [this]() {
+                return stopping || queuedJobs > 0;
+            });
+            if (stopping) {
+                return;
+            }
+        }
+    }
+
+    void JobSystem::push(Graph::Job *job) {
+        {
+            // Counted under the sleep mutex so that a worker about to sleep cannot miss the job
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            queuedJobs++;
+        }
+        Queue &queue = *queues[currentSystem == this ? currentQueue : 0];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.jobs.push_back(job);
+        }
+        wakeUp.notify_one();
+    }
+
+    JobSystem::Graph::Job *JobSystem::take() {
+        Size ownIndex = currentSystem == this ? currentQueue : 0;
+        Queue &own = *queues[ownIndex];
+        {
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.jobs.empty()) {
+                Graph::Job *job = own.jobs.back();
+                own.jobs.pop_back();
+                queuedJobs--;
+                return job;
+            }
+        }
+
+        for (Size i = 1; i < queues.size(); i++) {
+            Queue &victim = *queues[(ownIndex + i) % queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.jobs.empty()) {
+                Graph::Job *job = victim.jobs.front();
+                victim.jobs.pop_front();
+                queuedJobs--;
+                return job;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void JobSystem::execute(Graph::Job *job) {
+        Graph &graph = *job->graph;
+        try {
+            Math::RandomScope randomScope(*graph.randomEngine);
+            job->function();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(graph.errorMutex);
+            if (!graph.error) {
+                graph.error = std::current_exception();
+            }
+        }
+
+        for (Graph::Job *dependent : job->dependents) {
+            if (dependent->waitingFor.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                push(dependent);
+            }
+        }
+        graph.unfinishedJobs.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
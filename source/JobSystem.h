@@ -0,0 +1,142 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef DUEL6_JOBSYSTEM_H
+#define DUEL6_JOBSYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Type.h"
+#include "math/Math.h"
+
+namespace Duel6 {
+    /**
+     * Work-stealing scheduler of small jobs. Each worker thread owns a queue, takes its own jobs from the back and
+     * steals from the front of other queues when it has nothing to do. The thread running a graph helps with its
+     * jobs until the whole graph is finished.
+     */
+    class JobSystem {
+    public:
+        typedef Size JobId;
+
+        /**
+         * Jobs and the order in which they have to run. A job starts once all its prerequisites finished. All jobs
+         * use the random engine of the thread that runs the graph, jobs that draw random numbers have to be ordered
+         * by dependencies so that the sequence of random numbers stays deterministic.
+         */
+        class Graph {
+            friend class JobSystem;
+
+        private:
+            struct Job {
+                std::function<void()> function;
+                std::vector<Job *> dependents;
+                Int32 prerequisites;
+                std::atomic<Int32> waitingFor;
+                Graph *graph;
+
+                Job(const std::function<void()> &function, Graph *graph)
+                        : function(function), prerequisites(0), waitingFor(0), graph(graph) {}
+            };
+
+        private:
+            std::deque<Job> jobs;
+            std::atomic<Size> unfinishedJobs;
+            Math::RandomEngine *randomEngine;
+            std::mutex errorMutex;
+            std::exception_ptr error;
+
+        public:
+            Graph();
+
+            Graph(const Graph &) = delete;
+
+            Graph &operator=(const Graph &) = delete;
+
+            JobId add(const std::function<void()> &function);
+
+            /** The job does not start before the prerequisite finishes */
+            Graph &after(JobId job, JobId prerequisite);
+
+            Size size() const {
+                return jobs.size();
+            }
+        };
+
+    private:
+        struct Queue {
+            std::mutex mutex;
+            std::deque<Graph::Job *> jobs;
+        };
+
+    private:
+        std::vector<std::unique_ptr<Queue>> queues;
+        std::vector<std::thread> workers;
+        std::atomic<Size> queuedJobs;
+        std::mutex sleepMutex;
+        std::condition_variable wakeUp;
+        bool stopping;
+
+    public:
+        /** Threads other than the workers share the first queue */
+        explicit JobSystem(Size workerCount);
+
+        ~JobSystem();
+
+        JobSystem(const JobSystem &) = delete;
+
+        JobSystem &operator=(const JobSystem &) = delete;
+
+        /** Runs all jobs of the graph and returns when they are finished, rethrows the first exception of a job */
+        void run(Graph &graph);
+
+        Size getWorkerCount() const {
+            return workers.size();
+        }
+
+        /** One worker per hardware thread besides the calling one */
+        static Size getDefaultWorkerCount();
+
+    private:
+        void workerLoop(Size queueIndex);
+
+        void push(Graph::Job *job);
+
+        Graph::Job *take();
+
+        void execute(Graph::Job *job);
+    };
+}
+
+#endif
@@ -25,39 +25,118 @@
 * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <algorithm>
 #include <queue>
 #include "Game.h"
 #include "Level.h"
+#include "CompiledLevel.h"
 #include "json/JsonParser.h"
+#include "DataException.h"
 #include "GameException.h"
 
 namespace Duel6 {
     Level::Level(const std::string &path, bool mirror, const Block::Meta &blockMeta)
-            : blockMeta(blockMeta), raisingWater(false) {
+            : blockMeta(blockMeta), path(path), mirror(mirror), raisingWater(false) {
         load(path, mirror);
     }
 
     void Level::load(const std::string &path, bool mirror) {
         levelData.clear();
+        if (CompiledLevel::isAvailable(path)) {
+            loadCompiled(CompiledLevel::getPath(path), mirror);
+        } else {
+            loadJson(path, mirror);
+        }
+
+        buildCollisionGrid();
+        chooseWater();
+    }
+
+    void Level::chooseWater() {
+        setWaterBlock(findWaterType());
+    }
+
+    void Level::setWaterBlock(Uint16 block) {
+        waterBlock = block;
+        waterLevel = findWaterLevel(waterBlock);
+    }
+
+    void Level::loadJson(const std::string &path, bool mirror) {
         Json::Parser parser;
-        Json::Value root = parser.parse(path);
+        Json::Document document = parser.parseDocument(path);
+        Json::Node root = document.getRoot();
 
         width = root.get("width").asInt();
         height = root.get("height").asInt();
-        background = root.getOrDefault("background", Json::Value::makeString("")).asString();
+        background = root.has("background") ? root.get("background").asString() : "";
 
         Int32 blockCount = width * height;
-        Json::Value blocks = root.get("blocks");
-        levelData.resize(blockCount);
-        for (Size i = 0; i < blocks.getLength(); i++) {
-            levelData[i] = Uint16(blocks.get(i).asInt());
+        Json::Span<Int32> blocks = root.get("blocks").asIntArray();
+        if (blocks.size() > Size(blockCount)) {
+            D6_THROW(GameException, Format("Level {0} has {1} blocks, expected {2}") << path << blocks.size() << blockCount);
+        }
+        for (Size i = 0; i < blocks.size(); i++) {
+            if (blocks[i] < 0 || Size(blocks[i]) >= blockMeta.size()) {
+                D6_THROW(DataException, Format("Level {0} has unknown block {1} at index {2}")
+                        << path << blocks[i] << i);
+            }
         }
+        levelData.resize(blockCount);
+        std::copy(blocks.begin(), blocks.end(), levelData.begin());
 
         if (mirror) {
             mirrorLevelData();
         }
-        waterBlock = findWaterType();
-        waterLevel = findWaterLevel(waterBlock);
+    }
+
+    void Level::loadCompiled(const std::string &path, bool mirror) {
+        CompiledLevel level(path);
+        width = level.getWidth();
+        height = level.getHeight();
+        background = level.getBackground();
+
+        const Uint16 *blocks = (mirror && level.getMirroredBlocks() != nullptr) ? level.getMirroredBlocks()
+                                                                               : level.getBlocks();
+        levelData.assign(blocks, blocks + width * height);
+        // The binary file may have been converted against different block meta data
+        for (Size i = 0; i < levelData.size(); i++) {
+            if (levelData[i] >= blockMeta.size()) {
+                D6_THROW(DataException, Format("Compiled level {0} has unknown block {1} at index {2}")
+                        << path << levelData[i] << i);
+            }
+        }
+        if (mirror && level.getMirroredBlocks() == nullptr) {
+            mirrorLevelData();
+        }
+    }
+
+    void Level::buildCollisionGrid() {
+        gridStride = width + 2;
+        Int32 cells = gridStride * (height + 2);
+        collisionGrid.assign((cells + CELLS_PER_WORD - 1) / CELLS_PER_WORD, 0);
+        for (Int32 y = -1; y <= height; y++) {
+            for (Int32 x = -1; x <= width; x++) {
+                updateCollisionCell(x, y);
+            }
+        }
+    }
+
+    void Level::updateCollisionCell(Int32 x, Int32 y) {
+        Uint64 flags = 0;
+        if (!isInside(x, y)) {
+            flags = OutsideCell;
+        } else if (getBlockMeta(x, y).is(Block::Type::Wall)) {
+            flags = WallCell;
+        } else if (getBlockMeta(x, y).is(Block::Type::Water)) {
+            flags = WaterCell;
+        } else if (getBlockMeta(x, y).is(Block::Type::EmptySpace)) {
+            flags = EmptyCell;
+        }
+
+        Uint32 cell = Uint32((y + 1) * gridStride + x + 1);
+        Uint32 shift = cell % CELLS_PER_WORD * CELL_BITS;
+        Uint64 &word = collisionGrid[cell / CELLS_PER_WORD];
+        word = (word & ~(Uint64(CELL_MASK) << shift)) | (flags << shift);
     }
 
     void Level::mirrorLevelData() {
@@ -69,12 +148,21 @@ namespace Duel6 {
     }
 
     void Level::raiseWater() {
+        CellList changedCells;
+        raiseWater(changedCells);
+    }
+
+    void Level::raiseWater(CellList &changedCells) {
         raisingWater = true;
         if (waterLevel < getHeight() - 1) {
             waterLevel++;
             for (Int32 x = 0; x < getWidth(); x++) {
                 if (!isWall(x, waterLevel, false)) {
+                    if (getBlock(x, waterLevel) != waterBlock) {
+                        changedCells.emplace_back(x, waterLevel);
+                    }
                     setBlock(waterBlock, x, waterLevel);
+                    updateCollisionCell(x, waterLevel);
                 }
             }
         }
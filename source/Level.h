@@ -28,6 +28,7 @@
 #ifndef DUEL6_LEVEL_H
 #define DUEL6_LEVEL_H
 
+#include <algorithm>
 #include <string>
 #include <queue>
 #include <vector>
@@ -41,9 +42,25 @@ namespace Duel6 {
     public:
         typedef std::pair<Int32, Int32> StartingPosition;
         typedef std::vector<StartingPosition> StartingPositionList;
+        typedef std::pair<Int32, Int32> Cell;
+        typedef std::vector<Cell> CellList;
+
+    private:
+        enum CellFlag : Uint32 {
+            WallCell = 0x01,
+            WaterCell = 0x02,
+            EmptyCell = 0x04,
+            OutsideCell = 0x08
+        };
+
+        static const Int32 CELL_BITS = 4;
+        static const Int32 CELLS_PER_WORD = 64 / CELL_BITS;
+        static const Uint32 CELL_MASK = (1 << CELL_BITS) - 1;
 
     private:
         const Block::Meta &blockMeta;
+        std::string path;
+        bool mirror;
         Int32 width;
         Int32 height;
         std::string background;
@@ -51,10 +68,21 @@ namespace Duel6 {
         Uint16 waterBlock;
         Int32 waterLevel;
         bool raisingWater;
+        Int32 gridStride;
+        // Flags of all cells packed into 64-bit words, with one row and column of outside cells around the level
+        std::vector<Uint64> collisionGrid;
 
     public:
         Level(const std::string &path, bool mirror, const Block::Meta &blockMeta);
 
+        const std::string &getPath() const {
+            return path;
+        }
+
+        bool isMirror() const {
+            return mirror;
+        }
+
         Int32 getWidth() const {
             return width;
         }
@@ -68,21 +96,19 @@ namespace Duel6 {
         }
 
         bool isEmpty(Int32 x, Int32 y) const {
-            return isInside(x, y) ? getBlockMeta(x, y).is(Block::Type::EmptySpace) : false;
+            return (getCellFlags(x, y) & EmptyCell) != 0;
         }
 
         bool isWater(Int32 x, Int32 y) const {
-            return isInside(x, y) ? getBlockMeta(x, y).is(Block::Type::Water) : false;
+            return (getCellFlags(x, y) & WaterCell) != 0;
         }
 
         bool isWall(Int32 x, Int32 y, bool outside) const {
-            return isInside(x, y) ? getBlockMeta(x, y).is(Block::Type::Wall) : outside;
+            return (getCellFlags(x, y) & (WallCell | Uint32(outside) * OutsideCell)) != 0;
         }
 
         bool isWall(Float32 x, Float32 y, bool outside) const {
-            Int32 ix = (Int32) floorf(x);
-            Int32 iy = (Int32) floorf(y);
-            return isWall(ix, iy, outside);
+            return isWall(toCell(x, width), toCell(y, height), outside);
         }
 
         bool isInside(Int32 x, Int32 y) const {
@@ -97,6 +123,9 @@ namespace Duel6 {
 
         void raiseWater();
 
+        /** Floods the row above the water level, the cells that became water are appended to the list */
+        void raiseWater(CellList &changedCells);
+
         void findStartingPositions(StartingPositionList &startingPositions);
 
         void findTopmostNonWallPositions(StartingPositionList &startingPositions);
@@ -105,13 +134,43 @@ namespace Duel6 {
 
         bool isRaisingWater() const;
 
+        /** Chooses the water that rises in the level, a random one if the level contains no water */
+        void chooseWater();
+
+        Uint16 getWaterBlock() const {
+            return waterBlock;
+        }
+
+        /** Sets the water that rises in the level and the initial water level derived from it */
+        void setWaterBlock(Uint16 block);
+
     private:
         void load(const std::string &path, bool mirror);
 
+        void loadJson(const std::string &path, bool mirror);
+
+        void loadCompiled(const std::string &path, bool mirror);
+
         void mirrorLevelData();
 
         bool isPossibleStartingPosition(Int32 x, Int32 y);
 
+        Uint32 getCellFlags(Int32 x, Int32 y) const {
+            Uint32 cell = Uint32((std::min(std::max(y, -1), height) + 1) * gridStride + std::min(std::max(x, -1), width) + 1);
+            return Uint32(collisionGrid[cell / CELLS_PER_WORD] >> (cell % CELLS_PER_WORD * CELL_BITS)) & CELL_MASK;
+        }
+
+        static Int32 toCell(Float32 value, Int32 size) {
+            // Clamped before the conversion so that points far outside the level stay outside
+            Float32 clamped = std::min(std::max(value, -1.0f), Float32(size));
+            Int32 cell = Int32(clamped);
+            return cell - Int32(clamped < Float32(cell));
+        }
+
+        void buildCollisionGrid();
+
+        void updateCollisionCell(Int32 x, Int32 y);
+
         Uint16 getBlock(Int32 x, Int32 y) const {
             return levelData[(height - y - 1) * width + x];
         }
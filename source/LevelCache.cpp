@@ -0,0 +1,229 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include <algorithm>
+#include "LevelCache.h"
+#include "math/Math.h"
+
+namespace Duel6 {
+    LevelCache::Entry::Entry(const std::string &path, bool mirror, const Block::Meta &blockMeta)
+            : level(path, mirror, blockMeta) {
+        elevators.load(path, mirror);
+    }
+
+    LevelCache::LevelCache(const Block::Meta &blockMeta, Size capacity)
+            : blockMeta(blockMeta), capacity(capacity), loading(false), renderer(nullptr),
+              screenMode(ScreenMode::FullScreen), animationSpeed(0), running(true) {
+        thread = std::thread([this]() {
+            run();
+        });
+    }
+
+    LevelCache::~LevelCache() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running = false;
+        }
+        condition.notify_all();
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    std::shared_ptr<const LevelCache::Entry> LevelCache::get(const std::string &path, bool mirror) {
+        Key key(path, mirror);
+        std::unique_lock<std::mutex> lock(mutex);
+        waitUntilLoaded(lock, key);
+        std::shared_ptr<const Entry> entry = find(key);
+        if (entry == nullptr) {
+            lock.unlock();
+            entry = load(key);
+            lock.lock();
+            insert(key, entry);
+        }
+        return entry;
+    }
+
+    void LevelCache::prefetch(const std::string &path, bool mirror) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            Key key(path, mirror);
+            request(key);
+            recentRequests.push_back(key);
+            if (recentRequests.size() > 2) {
+                recentRequests.pop_front();
+            }
+        }
+        condition.notify_all();
+    }
+
+    void LevelCache::enableRenderData(Renderer &renderer, ScreenMode screenMode, Float32 animationSpeed) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (this->renderer == &renderer && this->screenMode == screenMode &&
+                this->animationSpeed == animationSpeed) {
+                return;
+            }
+            prepared.clear();
+            this->renderer = &renderer;
+            this->screenMode = screenMode;
+            this->animationSpeed = animationSpeed;
+            for (const Key &key : recentRequests) {
+                request(key);
+            }
+        }
+        condition.notify_all();
+    }
+
+    std::unique_ptr<LevelCache::RenderData> LevelCache::takeRenderData(const std::string &path, bool mirror) {
+        std::unique_lock<std::mutex> lock(mutex);
+        Key key(path, mirror);
+        waitUntilLoaded(lock, key);
+
+        auto it = std::find_if(prepared.begin(), prepared.end(), [&key](auto &item) {
+            return item.first == key;
+        });
+        if (it == prepared.end()) {
+            return nullptr;
+        }
+        std::unique_ptr<RenderData> renderData = std::make_unique<RenderData>(std::move(it->second));
+        prepared.erase(it);
+        return renderData;
+    }
+
+    void LevelCache::run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            condition.wait(lock, [this]() {
+                return !running || !requests.empty();
+            });
+            if (!running) {
+                return;
+            }
+
+            Key key = requests.front();
+            requests.pop_front();
+            std::shared_ptr<const Entry> entry = find(key);
+            // Faces are taken by the renderer, the same level may be prepared again for a later round
+            bool prepare = renderer != nullptr;
+            if (entry != nullptr && !prepare) {
+                continue;
+            }
+
+            Renderer *renderer = this->renderer;
+            ScreenMode screenMode = this->screenMode;
+            Float32 animationSpeed = this->animationSpeed;
+            loadingKey = key;
+            loading = true;
+            lock.unlock();
+
+            RenderData renderData;
+            try {
+                if (entry == nullptr) {
+                    entry = load(key);
+                }
+                if (prepare) {
+                    renderData.level = std::make_unique<Level>(entry->level);
+                    renderData.renderData = std::make_unique<LevelRenderData>(*renderData.level, *renderer,
+                                                                              screenMode, animationSpeed);
+                    renderData.renderData->generateFaces();
+                }
+            } catch (...) {
+                // Whoever needs the level loads it again and gets the error
+                entry = nullptr;
+                renderData = RenderData();
+            }
+
+            lock.lock();
+            loading = false;
+            if (entry != nullptr) {
+                insert(key, entry);
+            }
+            if (renderData.renderData != nullptr && renderer == this->renderer && screenMode == this->screenMode &&
+                animationSpeed == this->animationSpeed) {
+                prepared.emplace_back(key, std::move(renderData));
+                // Variants of levels that were not played again are dropped eventually
+                if (prepared.size() > capacity) {
+                    prepared.pop_front();
+                }
+            }
+            condition.notify_all();
+        }
+    }
+
+    void LevelCache::request(const Key &key) {
+        if (std::find(requests.begin(), requests.end(), key) == requests.end()) {
+            requests.push_back(key);
+        }
+    }
+
+    void LevelCache::waitUntilLoaded(std::unique_lock<std::mutex> &lock, const Key &key) {
+        // A queued request is served next, loading the level or its faces on this thread would repeat the work
+        auto queued = std::find(requests.begin(), requests.end(), key);
+        if (queued != requests.end()) {
+            requests.erase(queued);
+            requests.push_front(key);
+            condition.notify_all();
+        }
+        condition.wait(lock, [this, &key]() {
+            return (!loading || loadingKey != key) &&
+                   std::find(requests.begin(), requests.end(), key) == requests.end();
+        });
+    }
+
+    std::shared_ptr<const LevelCache::Entry> LevelCache::find(const Key &key) {
+        auto it = std::find_if(entries.begin(), entries.end(), [&key](auto &item) {
+            return item.first == key;
+        });
+        if (it == entries.end()) {
+            return nullptr;
+        }
+        entries.splice(entries.begin(), entries, it);
+        return it->second;
+    }
+
+    void LevelCache::insert(const Key &key, std::shared_ptr<const Entry> entry) {
+        auto it = std::find_if(entries.begin(), entries.end(), [&key](auto &item) {
+            return item.first == key;
+        });
+        if (it != entries.end()) {
+            entries.erase(it);
+        }
+        entries.emplace_front(key, std::move(entry));
+        if (entries.size() > capacity) {
+            entries.pop_back();
+        }
+    }
+
+    std::shared_ptr<const LevelCache::Entry> LevelCache::load(const Key &key) const {
+        // Levels without water draw a random one, the draw must not advance the engine of the game
+        Math::RandomEngine randomEngine;
+        Math::RandomScope randomScope(randomEngine);
+        return std::make_shared<const Entry>(key.first, key.second, blockMeta);
+    }
+}
@@ -0,0 +1,130 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#ifndef DUEL6_LEVELCACHE_H
+#define DUEL6_LEVELCACHE_H
+
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include "Type.h"
+#include "Block.h"
+#include "Level.h"
+#include "LevelRenderData.h"
+#include "collision/WorldCollision.h"
+#include "ElevatorList.h"
+#include "ScreenMode.h"
+
+namespace Duel6 {
+    /**
+     * Keeps recently used levels and loads the levels of upcoming rounds on a worker thread. Once a renderer
+     * is known the worker also generates the faces of the prefetched levels, the render thread then only
+     * uploads them.
+     */
+    class LevelCache {
+    public:
+        /** Level as loaded from its file, worlds choose the rising water of their own copy */
+        struct Entry {
+            Level level;
+            ElevatorList elevators;
+
+            Entry(const std::string &path, bool mirror, const Block::Meta &blockMeta);
+        };
+
+        struct RenderData {
+            std::unique_ptr<Level> level;
+            std::unique_ptr<LevelRenderData> renderData;
+        };
+
+    private:
+        typedef std::pair<std::string, bool> Key;
+
+        const Block::Meta &blockMeta;
+        Size capacity;
+        std::mutex mutex;
+        std::condition_variable condition;
+        // Most recently used first
+        std::list<std::pair<Key, std::shared_ptr<const Entry>>> entries;
+        std::deque<Key> requests;
+        // Prepared again when the renderer changes, the first prefetch usually comes before the first frame
+        std::deque<Key> recentRequests;
+        std::list<std::pair<Key, RenderData>> prepared;
+        Key loadingKey;
+        bool loading;
+        Renderer *renderer;
+        ScreenMode screenMode;
+        Float32 animationSpeed;
+        bool running;
+        std::thread thread;
+
+    public:
+        explicit LevelCache(const Block::Meta &blockMeta, Size capacity = 8);
+
+        ~LevelCache();
+
+        LevelCache(const LevelCache &) = delete;
+
+        LevelCache &operator=(const LevelCache &) = delete;
+
+        /**
+         * Waits for the level if it is queued or being prefetched, loads it on the calling thread if it is not cached
+         */
+        std::shared_ptr<const Entry> get(const std::string &path, bool mirror);
+
+        void prefetch(const std::string &path, bool mirror);
+
+        /** Makes the worker generate faces of prefetched levels for the given renderer */
+        void enableRenderData(Renderer &renderer, ScreenMode screenMode, Float32 animationSpeed);
+
+        /**
+         * Waits for the faces of a queued or running prefetch, null if the level was not prefetched. Prepared faces
+         * can only be taken once.
+         */
+        std::unique_ptr<RenderData> takeRenderData(const std::string &path, bool mirror);
+
+    private:
+        void run();
+
+        void request(const Key &key);
+
+        void waitUntilLoaded(std::unique_lock<std::mutex> &lock, const Key &key);
+
+        std::shared_ptr<const Entry> find(const Key &key);
+
+        void insert(const Key &key, std::shared_ptr<const Entry> entry);
+
+        std::shared_ptr<const Entry> load(const Key &key) const;
+    };
+}
+
+#endif
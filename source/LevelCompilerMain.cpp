@@ -0,0 +1,93 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "CompiledLevel.h"
+#include "Defines.h"
+#include "Exception.h"
+#include "File.h"
+#include "json/JsonParser.h"
+
+static void printUsage() {
+    printf("Usage: duel6r-levelc [options] [level.json ...]\n"
+           "Converts JSON levels to the binary format loaded by the game, all levels in %s by default.\n"
+           "  -no-mirror                  do not store the horizontally mirrored block grid\n"
+           "  -blocks <path>              block meta data the levels are checked against (default: %s)\n",
+           D6_FILE_LEVEL, D6_FILE_BLOCK_META);
+}
+
+int main(int argc, char **argv) {
+    bool mirror = true;
+    std::string blockMetaPath = D6_FILE_BLOCK_META;
+    std::vector<std::string> levels;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-no-mirror") {
+            mirror = false;
+        } else if (arg == "-blocks" && i + 1 < argc) {
+            blockMetaPath = argv[++i];
+        } else if (arg == "-help" || arg == "-h") {
+            printUsage();
+            return 0;
+        } else if (!arg.empty() && arg[0] == '-') {
+            printUsage();
+            fprintf(stderr, "Unknown command line argument %s\n", arg.c_str());
+            return 1;
+        } else {
+            levels.push_back(arg);
+        }
+    }
+
+    try {
+        // Only the number of blocks is needed, levels index the block array
+        Duel6::Json::Parser parser;
+        Duel6::Size blockCount = parser.parseDocument(blockMetaPath).getRoot().getLength();
+
+        if (levels.empty()) {
+            for (const std::string &file : Duel6::File::listDirectory(D6_FILE_LEVEL, D6_LEVEL_EXTENSION)) {
+                levels.push_back(D6_FILE_LEVEL + file);
+            }
+        }
+
+        for (const std::string &level : levels) {
+            std::string path = Duel6::CompiledLevel::getPath(level);
+            Duel6::CompiledLevel::compile(level, path, mirror, blockCount);
+            printf("%s -> %s (%zu bytes)\n", level.c_str(), path.c_str(), Duel6::File::getSize(path));
+        }
+        return 0;
+    }
+    catch (const Duel6::Exception &e) {
+        fprintf(stderr, "Error occured: %s\nAt: %s: %d\n", e.getMessage().c_str(), e.getFile().c_str(), e.getLine());
+    }
+    catch (const std::exception &e) {
+        fprintf(stderr, "Error occured: %s\n", e.what());
+    }
+
+    return 1;
+}
@@ -28,11 +28,17 @@
 
 #include <algorithm>
 #include "LevelRenderData.h"
+#include "Defines.h"
 
 namespace Duel6 {
     LevelRenderData::LevelRenderData(const Level &level, Renderer &renderer, ScreenMode screenMode,
                                      Float32 animationSpeed)
-            : level(level), renderer(renderer), screenMode(screenMode), animationSpeed(animationSpeed), animWait(0) {}
+            : level(level), renderer(renderer), screenMode(screenMode), animationSpeed(animationSpeed) {
+        walls.resize(level.getWidth(), level.getHeight(), 0);
+        sprites.resize(level.getWidth(), level.getHeight(), 0);
+        water.resize(level.getWidth(), level.getHeight(), 2 * D6_WAVE_HEIGHT);
+        water.reserve(3);
+    }
 
     void LevelRenderData::generateFaces() {
         addWallFaces();
@@ -44,30 +50,108 @@ namespace Duel6 {
         addWaterFaces();
     }
 
-    void LevelRenderData::update(Float32 elapsedTime) {
-        animWait += elapsedTime;
-        if (animWait > animationSpeed) {
-            animWait = 0;
-            walls.nextFrame();
-            sprites.nextFrame();
-            water.nextFrame();
+    void LevelRenderData::updateWater(const Level::CellList &changedCells) {
+        // Water surface and waterfalls depend on the cells below and above
+        for (const Level::Cell &cell : changedCells) {
+            for (Int32 y = std::max(0, cell.second - 1); y <= std::min(level.getHeight() - 1, cell.second + 1); y++) {
+                addWaterCell(cell.first, y);
+            }
         }
     }
 
+    void LevelRenderData::update(Float32 time) {
+        walls.setAnimationTime(time);
+        sprites.setAnimationTime(time);
+        water.setAnimationTime(time);
+    }
+
     void LevelRenderData::addWallFaces() {
         walls.clear();
+        unmergedWallFaces = 0;
+
+        Int32 width = level.getWidth();
+        Int32 height = level.getHeight();
+        std::vector<bool> merged(Size(width * height), false);
+
+        // Front faces, rectangles of the same block grown first along x and then along y
+        for (Int32 y = 0; y < height; y++) {
+            for (Int32 x = 0; x < width; x++) {
+                if (merged[y * width + x] || !isWallBlock(x, y)) {
+                    continue;
+                }
 
-        for (Int32 y = 0; y < level.getHeight(); y++) {
-            for (Int32 x = 0; x < level.getWidth(); x++) {
                 const Block &block = level.getBlockMeta(x, y);
+                Int32 endX = std::min(width, ChunkedFaceList::getChunkEnd(x));
+                Int32 endY = std::min(height, ChunkedFaceList::getChunkEnd(y));
+                Int32 runWidth = 1, runHeight = 1;
+                while (x + runWidth < endX && !merged[y * width + x + runWidth] &&
+                       canMergeWalls(block, x + runWidth, y)) {
+                    runWidth++;
+                }
+                while (y + runHeight < endY && canMergeWallRow(block, x, y + runHeight, runWidth, merged)) {
+                    runHeight++;
+                }
 
-                if (block.is(Block::Type::Wall)) {
-                    addWall(block, x, y);
+                for (Int32 j = y; j < y + runHeight; j++) {
+                    std::fill_n(merged.begin() + j * width + x, runWidth, true);
                 }
+
+                addWallFace(walls.getChunk(x, y), block, runWidth, runHeight,
+                            Vector(x, y + runHeight, 1), Vector(x + runWidth, y + runHeight, 1),
+                            Vector(x + runWidth, y, 1), Vector(x, y, 1));
+                unmergedWallFaces += Size(runWidth * runHeight);
             }
         }
 
-        walls.build(renderer);
+        // Side faces, runs of the same block along the face
+        bool splitScreen = screenMode == ScreenMode::SplitScreen;
+        for (Int32 x = 0; x < width; x++) {
+            bool left = splitScreen || x > width / 2;
+            bool right = splitScreen || x < width / 2;
+
+            for (Int32 y = 0; y < height;) {
+                Int32 run = left ? getWallRun(x, y, 0, 1, -1, 0) : 1;
+                if (run > 0) {
+                    addWallFace(walls.getChunk(x, y), level.getBlockMeta(x, y), 1, run, Vector(x, y + run, 0),
+                                Vector(x, y + run, 1), Vector(x, y, 1), Vector(x, y, 0));
+                }
+                y += std::max(run, 1);
+            }
+
+            for (Int32 y = 0; y < height;) {
+                Int32 run = right ? getWallRun(x, y, 0, 1, 1, 0) : 1;
+                if (run > 0) {
+                    addWallFace(walls.getChunk(x, y), level.getBlockMeta(x, y), 1, run, Vector(x + 1, y + run, 1),
+                                Vector(x + 1, y + run, 0), Vector(x + 1, y, 0), Vector(x + 1, y, 1));
+                }
+                y += std::max(run, 1);
+            }
+        }
+
+        for (Int32 y = 0; y < height; y++) {
+            bool top = splitScreen || y < height / 2;
+            bool bottom = splitScreen || y > height / 2;
+
+            for (Int32 x = 0; x < width;) {
+                Int32 run = top ? getWallRun(x, y, 1, 0, 0, 1) : 1;
+                if (run > 0) {
+                    addWallFace(walls.getChunk(x, y), level.getBlockMeta(x, y), 1, run, Vector(x, y + 1, 1),
+                                Vector(x, y + 1, 0), Vector(x + run, y + 1, 0), Vector(x + run, y + 1, 1));
+                }
+                x += std::max(run, 1);
+            }
+
+            for (Int32 x = 0; x < width;) {
+                Int32 run = bottom ? getWallRun(x, y, 1, 0, 0, -1) : 1;
+                if (run > 0) {
+                    addWallFace(walls.getChunk(x, y), level.getBlockMeta(x, y), run, 1, Vector(x, y, 1),
+                                Vector(x + run, y, 1), Vector(x + run, y, 0), Vector(x, y, 0));
+                }
+                x += std::max(run, 1);
+            }
+        }
+
+        walls.build(renderer, animationSpeed);
     }
 
     void LevelRenderData::addSpriteFaces() {
@@ -82,21 +166,21 @@ namespace Duel6 {
                 }
 
                 if (block.is(Block::Type::FrontAndBackSprite)) {
-                    addSprite(sprites, block, x, y, 1.0f);
-                    addSprite(sprites, block, x, y, 0.0f);
+                    addSprite(sprites.getChunk(x, y), block, x, y, 1.0f);
+                    addSprite(sprites.getChunk(x, y), block, x, y, 0.0f);
                 } else if (block.is(Block::Type::FrontSprite)) {
-                    addSprite(sprites, block, x, y, 1.0f);
+                    addSprite(sprites.getChunk(x, y), block, x, y, 1.0f);
                 } else if (block.is(Block::Type::BackSprite)) {
-                    addSprite(sprites, block, x, y, 0.0f);
+                    addSprite(sprites.getChunk(x, y), block, x, y, 0.0f);
                 } else if (block.is(Block::Type::Front4Sprite)) {
-                    addSprite(sprites, block, x, y, 0.75f);
+                    addSprite(sprites.getChunk(x, y), block, x, y, 0.75f);
                 } else if (block.is(Block::Type::Back4Sprite)) {
-                    addSprite(sprites, block, x, y, 0.25f);
+                    addSprite(sprites.getChunk(x, y), block, x, y, 0.25f);
                 }
             }
         }
 
-        sprites.build(renderer);
+        sprites.build(renderer, animationSpeed);
     }
 
     void LevelRenderData::addWaterFaces() {
@@ -104,91 +188,106 @@ namespace Duel6 {
 
         for (Int32 y = 0; y < level.getHeight(); y++) {
             for (Int32 x = 0; x < level.getWidth(); x++) {
-                const Block &block = level.getBlockMeta(x, y);
-
-                if (block.is(Block::Type::Waterfall)) {
-                    addSprite(water, block, x, y, 0.75);
-                } else if (block.is(Block::Type::Water)) {
-                    addWater(block, x, y);
-                }
+                addWaterCell(x, y);
             }
         }
 
-        water.build(renderer);
+        water.build(renderer, animationSpeed);
     }
 
-    void LevelRenderData::addWall(const Block &block, Int32 x, Int32 y) {
-        Int32 width = level.getWidth();
-        Int32 height = level.getHeight();
-        bool splitScreen = screenMode == ScreenMode::SplitScreen;
-        bool left = splitScreen || x > width / 2;
-        bool right = splitScreen || x < width / 2;
-        bool top = splitScreen || y < height / 2;
-        bool bottom = splitScreen || y > height / 2;
-
-        walls.addFace(Face(block))
-                .addVertex(Vertex(0, x, y + 1, 1))
-                .addVertex(Vertex(1, x + 1, y + 1, 1))
-                .addVertex(Vertex(2, x + 1, y, 1))
-                .addVertex(Vertex(3, x, y, 1));
-
+    void LevelRenderData::addWaterCell(Int32 x, Int32 y) {
+        const Block &block = level.getBlockMeta(x, y);
+        waterCell.clear();
 
-#ifdef D6_RENDER_BACKS
-        faceList.addFace(Face(block))
-            .addVertex(Vertex(0, x + 1, y + 1, 0))
-            .addVertex(Vertex(1, x, y + 1, 0))
-            .addVertex(Vertex(2, x, y, 0))
-            .addVertex(Vertex(3, x + 1, y, 0));
-#endif
-
-        if (left && !level.isWall(x - 1, y, false)) {
-            walls.addFace(Face(block))
-                    .addVertex(Vertex(0, x, y + 1, 0))
-                    .addVertex(Vertex(1, x, y + 1, 1))
-                    .addVertex(Vertex(2, x, y, 1))
-                    .addVertex(Vertex(3, x, y, 0));
+        if (block.is(Block::Type::Waterfall)) {
+            addSprite(waterCell, block, x, y, 0.75);
+        } else if (block.is(Block::Type::Water)) {
+            addWater(waterCell, block, x, y);
         }
-        if (right && !level.isWall(x + 1, y, false)) {
-            walls.addFace(Face(block))
-                    .addVertex(Vertex(0, x + 1, y + 1, 1))
-                    .addVertex(Vertex(1, x + 1, y + 1, 0))
-                    .addVertex(Vertex(2, x + 1, y, 0))
-                    .addVertex(Vertex(3, x + 1, y, 1));
+
+        water.setCellFaces(x, y, waterCell);
+    }
+
+    bool LevelRenderData::isWallBlock(Int32 x, Int32 y) const {
+        return level.getBlockMeta(x, y).is(Block::Type::Wall);
+    }
+
+    bool LevelRenderData::canMergeWalls(const Block &block, Int32 x, Int32 y) const {
+        return block.getAnimationFrames() == 1 && &level.getBlockMeta(x, y) == &block;
+    }
+
+    bool LevelRenderData::canMergeWallRow(const Block &block, Int32 x, Int32 y, Int32 width,
+                                          const std::vector<bool> &merged) const {
+        for (Int32 i = x; i < x + width; i++) {
+            if (merged[y * level.getWidth() + i] || !canMergeWalls(block, i, y)) {
+                return false;
+            }
         }
-        if (top && !level.isWall(x, y + 1, false)) {
-            walls.addFace(Face(block))
-                    .addVertex(Vertex(0, x, y + 1, 1))
-                    .addVertex(Vertex(1, x, y + 1, 0))
-                    .addVertex(Vertex(2, x + 1, y + 1, 0))
-                    .addVertex(Vertex(3, x + 1, y + 1, 1));
+        return true;
+    }
+
+    Int32 LevelRenderData::getWallRun(Int32 x, Int32 y, Int32 stepX, Int32 stepY, Int32 normalX,
+                                      Int32 normalY) {
+        auto isVisible = [this, normalX, normalY](Int32 x, Int32 y) {
+            return isWallBlock(x, y) && !level.isWall(x + normalX, y + normalY, false);
+        };
+
+        if (!isVisible(x, y)) {
+            return 0;
         }
-        if (bottom && !level.isWall(x, y - 1, false)) {
-            walls.addFace(Face(block))
-                    .addVertex(Vertex(0, x, y, 1))
-                    .addVertex(Vertex(1, x + 1, y, 1))
-                    .addVertex(Vertex(2, x + 1, y, 0))
-                    .addVertex(Vertex(3, x, y, 0));
+
+        const Block &block = level.getBlockMeta(x, y);
+        Int32 start = stepX != 0 ? x : y;
+        Int32 size = stepX != 0 ? level.getWidth() : level.getHeight();
+        Int32 end = std::min(size, ChunkedFaceList::getChunkEnd(start));
+        Int32 run = 1;
+        while (start + run < end && isVisible(x + run * stepX, y + run * stepY) &&
+               canMergeWalls(block, x + run * stepX, y + run * stepY)) {
+            run++;
         }
+        unmergedWallFaces += Size(run);
+        return run;
+    }
+
+    void LevelRenderData::addWallFace(FaceList &faces, const Block &block, Int32 blocksU, Int32 blocksV,
+                                      const Vector &v0, const Vector &v1, const Vector &v2, const Vector &v3) {
+        // The texture repeats once per covered block so that tile edges fall on block edges, the renderers wrap
+        // coordinates above 1 themselves. A single block keeps the 0.99 inset of unmerged faces.
+        auto extent = [](Float32 coordinate, Int32 blocks) {
+            return coordinate > 0 && blocks > 1 ? Float32(blocks) : coordinate;
+        };
+        auto vertex = [blocksU, blocksV, &extent](Size order, const Vector &position) {
+            Vertex vertex(order, position.x, position.y, position.z);
+            vertex.u = extent(vertex.u, blocksU);
+            vertex.v = extent(vertex.v, blocksV);
+            return vertex;
+        };
+
+        faces.addFace(Face(block))
+                .addVertex(vertex(0, v0))
+                .addVertex(vertex(1, v1))
+                .addVertex(vertex(2, v2))
+                .addVertex(vertex(3, v3));
     }
 
-    void LevelRenderData::addWater(const Block &block, Int32 x, Int32 y) {
+    void LevelRenderData::addWater(FaceList &faces, const Block &block, Int32 x, Int32 y) {
         bool topWater = !level.isWater(x, y + 1);
         Vertex::Flag flowFlag = topWater ? Vertex::Flag::Flow : Vertex::Flag::None;
 
-        water.addFace(Face(block))
+        faces.addFace(Face(block))
                 .addVertex(Vertex(0, x, y + 1, 1, flowFlag))
                 .addVertex(Vertex(1, x + 1, y + 1, 1, flowFlag))
                 .addVertex(Vertex(2, x + 1, y, 1))
                 .addVertex(Vertex(3, x, y, 1));
 
-        water.addFace(Face(block))
+        faces.addFace(Face(block))
                 .addVertex(Vertex(0, x + 1, y + 1, 0, flowFlag))
                 .addVertex(Vertex(1, x, y + 1, 0, flowFlag))
                 .addVertex(Vertex(2, x, y, 0))
                 .addVertex(Vertex(3, x + 1, y, 0));
 
         if (topWater) {
-            water.addFace(Face(block))
+            faces.addFace(Face(block))
                     .addVertex(Vertex(0, x, y + 1, 1, Vertex::Flag::Flow))
                     .addVertex(Vertex(1, x, y + 1, 0, Vertex::Flag::Flow))
                     .addVertex(Vertex(2, x + 1, y + 1, 0, Vertex::Flag::Flow))
@@ -28,10 +28,12 @@
 #ifndef DUEL6_LEVELRENDERDATA_H
 #define DUEL6_LEVELRENDERDATA_H
 
+#include <vector>
 #include "Type.h"
-#include "FaceList.h"
+#include "ChunkedFaceList.h"
 #include "Level.h"
 #include "ScreenMode.h"
+#include "math/Vector.h"
 
 namespace Duel6 {
     class LevelRenderData {
@@ -39,11 +41,12 @@ namespace Duel6 {
         const Level &level;
         Renderer &renderer;
         ScreenMode screenMode;
-        FaceList walls;
-        FaceList sprites;
-        FaceList water;
+        ChunkedFaceList walls;
+        ChunkedFaceList sprites;
+        ChunkedFaceList water;
+        FaceList waterCell;
         Float32 animationSpeed;
-        Float32 animWait;
+        Size unmergedWallFaces = 0;
 
     public:
         LevelRenderData(const Level &level, Renderer &renderer, ScreenMode screenMode, Float32 animationSpeed);
@@ -52,29 +55,38 @@ namespace Duel6 {
 
         void generateWater();
 
-        void update(Float32 elapsedTime);
+        /** Replaces only the water faces of cells next to the changed ones */
+        void updateWater(const Level::CellList &changedCells);
 
-        FaceList &getWalls() {
+        /** Animates the faces, the time is the global time of the renderer */
+        void update(Float32 time);
+
+        ChunkedFaceList &getWalls() {
             return walls;
         }
 
-        const FaceList &getWalls() const {
+        const ChunkedFaceList &getWalls() const {
             return walls;
         }
 
-        FaceList &getSprites() {
+        /** Number of wall faces before coplanar faces of the same block were merged */
+        Size getUnmergedWallFaces() const {
+            return unmergedWallFaces;
+        }
+
+        ChunkedFaceList &getSprites() {
             return sprites;
         }
 
-        const FaceList &getSprites() const {
+        const ChunkedFaceList &getSprites() const {
             return sprites;
         }
 
-        FaceList &getWater() {
+        ChunkedFaceList &getWater() {
             return water;
         }
 
-        const FaceList &getWater() const {
+        const ChunkedFaceList &getWater() const {
             return water;
         }
 
@@ -85,9 +97,21 @@ namespace Duel6 {
 
         void addWaterFaces();
 
-        void addWall(const Block &block, Int32 x, Int32 y);
+        void addWaterCell(Int32 x, Int32 y);
+
+        bool isWallBlock(Int32 x, Int32 y) const;
+
+        bool canMergeWalls(const Block &block, Int32 x, Int32 y) const;
+
+        bool canMergeWallRow(const Block &block, Int32 x, Int32 y, Int32 width, const std::vector<bool> &merged) const;
+
+        /** Length of the run of visible wall faces with the given normal starting at x, y, 0 if there is no face */
+        Int32 getWallRun(Int32 x, Int32 y, Int32 stepX, Int32 stepY, Int32 normalX, Int32 normalY);
+
+        void addWallFace(FaceList &faces, const Block &block, Int32 blocksU, Int32 blocksV, const Vector &v0,
+                         const Vector &v1, const Vector &v2, const Vector &v3);
 
-        void addWater(const Block &block, Int32 x, Int32 y);
+        void addWater(FaceList &faces, const Block &block, Int32 x, Int32 y);
 
         void addSprite(FaceList &faceList, const Block &block, Int32 x, Int32 y, Float32 z);
     };
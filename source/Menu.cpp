@@ -398,7 +398,7 @@ namespace Duel6 {
     }
 
     void Menu::detectControls(Size playerIndex) {
-        render();
+        render(0);
         if (playerIndex >= playerListBox->size()) {
             return;
         }
@@ -566,7 +566,7 @@ namespace Duel6 {
         gui.update(elapsedTime);
     }
 
-    void Menu::render() const {
+    void Menu::render(Float32 interpolation) const {
         Int32 trX = (video.getScreen().getClientWidth() - 800) / 2;
         Int32 trY = (video.getScreen().getClientHeight() - 700) / 2;
 
@@ -737,7 +737,7 @@ namespace Duel6 {
             controls.push_back(controlSwitch[i]->currentItem());
         }
 
-        std::shuffle(shuffle.begin(), shuffle.end(), Math::randomEngine);
+        std::shuffle(shuffle.begin(), shuffle.end(), Math::getRandomEngine());
 
         playerListBox->clear();
         for (Size i = 0; i < playerCount; i++) {
@@ -782,7 +782,7 @@ namespace Duel6 {
         for (Int32 start = 0; start < Int32(playerCount); start += teamPlayerCount) {
             auto span = std::min(teamPlayerCount, Int32(playerCount) - start);
             auto first = shuffle.begin() + start;
-            std::shuffle(first, first + span, Math::randomEngine);
+            std::shuffle(first, first + span, Math::getRandomEngine());
         }
 
         playerListBox->clear();
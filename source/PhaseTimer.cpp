@@ -0,0 +1,58 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "PhaseTimer.h"
+#include "Format.h"
+
+namespace Duel6 {
+    namespace {
+        std::string formatMilliseconds(Float64 seconds) {
+            Int32 tenths = Int32(seconds * 10000 + 0.5);
+            return Format("{0}.{1} ms") << tenths / 10 << tenths % 10;
+        }
+    }
+
+    PhaseTimer::PhaseTimer()
+            : phaseStart(Clock::now()) {}
+
+    void PhaseTimer::endPhase(const std::string &name) {
+        Clock::time_point now = Clock::now();
+        phases.emplace_back(name, std::chrono::duration<Float64>(now - phaseStart).count());
+        phaseStart = now;
+    }
+
+    void PhaseTimer::print(Console &console, const std::string &title) const {
+        console.printLine(Format("\n==={0}===") << title);
+        Float64 total = 0;
+        for (const auto &phase : phases) {
+            console.printLine(Format("...{0,-28}{1,12}") << phase.first << formatMilliseconds(phase.second));
+            total += phase.second;
+        }
+        console.printLine(Format("...{0,-28}{1,12}") << "Total" << formatMilliseconds(total));
+    }
+}
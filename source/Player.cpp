@@ -55,7 +55,8 @@ namespace Duel6 {
               animations(skin.getAnimations()),
               sounds(sounds),
               controls(controls),
-              orientation(Orientation::Left) {
+              orientation(Orientation::Left),
+              snapshotted(false) {
         camera.rotate(180.0, 0.0, 0.0);
     }
 
@@ -94,12 +95,13 @@ namespace Duel6 {
         indicators.getBonus().show(bonusDuration);
         indicators.getBullets().show(4.0f);
 
-        roundStartTime = clock();
+        roundStartTime = world.getTime();
         getPerson().addGames(1);
+        snapshotted = false;
     }
 
     void Player::endRound() {
-        Int32 gameTime = Int32((clock() - roundStartTime) / CLOCKS_PER_SEC);
+        Int32 gameTime = Int32(world->getTime() - roundStartTime);
         getPerson().addTotalGameTime(gameTime);
         if (isAlive()) {
             getPerson().addTimeAlive(gameTime);
@@ -562,6 +564,18 @@ namespace Duel6 {
         }
     }
 
+    void Player::takeSnapshot(Vector &previousCentre, Vector &previousCameraPosition) {
+        if (!snapshotted) {
+            snapshotCentre = getCentre();
+            snapshotCameraPosition = camera.getPosition();
+            snapshotted = true;
+        }
+        previousCentre = snapshotCentre;
+        previousCameraPosition = snapshotCameraPosition;
+        snapshotCentre = getCentre();
+        snapshotCameraPosition = camera.getPosition();
+    }
+
     void Player::updateCam(Int32 levelSizeX, Int32 levelSizeY) {
         Float32 mX = 0.0, mY = 0.0;
         Vector centre = getCentre();
@@ -802,7 +816,7 @@ namespace Duel6 {
         sprite->setPosition(getSpritePosition()).setLooping(AnimationLooping::OnceAndStop);
         gunSprite->setDraw(false);
 
-        Int32 timeAlive = Int32((clock() - roundStartTime) / CLOCKS_PER_SEC);
+        Int32 timeAlive = Int32(world->getTime() - roundStartTime);
         getPerson().addTimeAlive(timeAlive);
     }
 
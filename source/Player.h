@@ -30,7 +30,6 @@
 
 #include <memory>
 #include <string>
-#include <time.h>
 #include "math/Camera.h"
 #include "SpriteList.h"
 #include "Person.h"
@@ -111,8 +110,8 @@ namespace Duel6 {
         const PlayerControls &controls;
         PlayerView view;
         WaterState water;
-        SpriteList::Iterator sprite;
-        SpriteList::Iterator gunSprite;
+        SpriteList::Handle sprite;
+        SpriteList::Handle gunSprite;
         Uint32 flags;
         Orientation orientation;
         Float32 life;
@@ -131,10 +130,13 @@ namespace Duel6 {
         PlayerEventListener *eventListener;
         World *world; // TODO: Remove
         Float32 bodyAlpha;
-        clock_t roundStartTime;
+        Float32 roundStartTime;
         PlayerIndicators indicators;
         Uint32 controllerState;
         CollidingEntity collider;
+        Vector snapshotCentre;
+        Vector snapshotCameraPosition;
+        bool snapshotted;
 
     public:
         Player(Person &person, const PlayerSkin &skin, const PlayerSounds &sounds, const PlayerControls &controls);
@@ -401,10 +403,24 @@ namespace Duel6 {
             controllerState |= button;
         }
 
+        Uint32 getControllerState() const {
+            return controllerState;
+        }
+
+        void setControllerState(Uint32 state) {
+            controllerState = state;
+        }
+
         void die();
 
         const CollidingEntity &getCollider() const;
 
+        /**
+         * Remembers the current centre and camera position for the next game snapshot and returns the ones
+         * of the previous snapshot, rendering interpolates between them.
+         */
+        void takeSnapshot(Vector &previousCentre, Vector &previousCameraPosition);
+
     private:
         void makeMove(const Level &level, Float32 elapsedTime);
 
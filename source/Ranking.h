@@ -68,11 +68,11 @@ namespace Duel6 {
     public:
         Ranking() = default;
 
-        Int32 getMaxLength() {
+        Int32 getMaxLength() const {
             Int32 maxLength = 0;
-            for (auto &entry : entries) {
+            for (const auto &entry : entries) {
                 maxLength = std::max(maxLength, Int32(entry.name.size()));
-                for (auto &subEntry : entry.entries) {
+                for (const auto &subEntry : entry.entries) {
                     maxLength = std::max(maxLength, Int32(subEntry.name.size()));
                 }
             }
@@ -0,0 +1,304 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <string.h>
+#include <algorithm>
+#include "DataException.h"
+#include "Format.h"
+#include "IoException.h"
+#include "World.h"
+#include "Replay.h"
+
+namespace Duel6 {
+    namespace {
+        const char REPLAY_MAGIC[4] = {'D', '6', 'R', 'P'};
+        const Uint32 REPLAY_VERSION = 1;
+
+        // Values are stored in native byte order, all supported platforms are little endian
+        template<class T>
+        void writeValue(File &file, T value) {
+            file.write(&value, sizeof(T), 1);
+        }
+
+        template<class T>
+        T readValue(File &file) {
+            T value;
+            file.read(&value, sizeof(T), 1);
+            return value;
+        }
+
+        void writeString(File &file, const std::string &value) {
+            writeValue(file, Uint32(value.size()));
+            file.write(value.data(), 1, value.size());
+        }
+
+        /** Reads the number of following elements, a count the rest of the file cannot hold is corrupt */
+        Size readCount(File &file, Size fileSize, Size elementSize) {
+            Size count = readValue<Uint32>(file);
+            Size position = file.getPosition();
+            if (position > fileSize || count > (fileSize - position) / elementSize) {
+                D6_THROW(DataException, Format("Replay element count {0} exceeds the size of the file") << count);
+            }
+            return count;
+        }
+
+        std::string readString(File &file, Size fileSize) {
+            std::string value(readCount(file, fileSize, 1), '\0');
+            if (!value.empty()) {
+                file.read(&value[0], 1, value.size());
+            }
+            return value;
+        }
+
+        class Fnv1a {
+        private:
+            Uint32 hash = 2166136261u;
+
+        public:
+            Fnv1a &add(const void *data, Size size) {
+                const Uint8 *bytes = static_cast<const Uint8 *>(data);
+                for (Size i = 0; i < size; i++) {
+                    hash = (hash ^ bytes[i]) * 16777619u;
+                }
+                return *this;
+            }
+
+            template<class T>
+            Fnv1a &add(T value) {
+                return add(&value, sizeof(T));
+            }
+
+            Uint32 get() const {
+                return hash;
+            }
+        };
+    }
+
+    Replay::Round::Round(Uint32 seed, const std::string &level, bool mirror, Size players)
+            : seed(seed), level(level), mirror(mirror), players(players) {}
+
+    const Replay::Keyframe *Replay::Round::findKeyframe(Uint32 tick) const {
+        auto next = std::upper_bound(keyframes.begin(), keyframes.end(), tick,
+                                     [](Uint32 tick, const Keyframe &keyframe) {
+                                         return tick < keyframe.tick;
+                                     });
+        return next == keyframes.begin() ? nullptr : &*(next - 1);
+    }
+
+    void Replay::Round::save(File &file) const {
+        writeValue(file, seed);
+        writeString(file, level);
+        writeValue(file, Uint8(mirror ? 1 : 0));
+        writeValue(file, Uint32(players));
+        writeValue(file, Uint32(inputs.size()));
+        file.write(inputs.data(), 1, inputs.size());
+        writeValue(file, Uint32(keyframes.size()));
+        for (const Keyframe &keyframe : keyframes) {
+            writeValue(file, keyframe.tick);
+            writeValue(file, keyframe.checksum);
+        }
+    }
+
+    Replay::Round Replay::Round::load(File &file, Size fileSize, Size playerCount) {
+        Uint32 seed = readValue<Uint32>(file);
+        std::string level = readString(file, fileSize);
+        bool mirror = readValue<Uint8>(file) != 0;
+        Size players = readValue<Uint32>(file);
+        if (players != playerCount) {
+            D6_THROW(DataException, Format("Replay round has inputs of {0} players, the game has {1}") << players
+                                                                                                     << playerCount);
+        }
+        Round round(seed, level, mirror, players);
+
+        round.inputs.resize(readCount(file, fileSize, 1));
+        if (round.inputs.size() % players != 0) {
+            D6_THROW(DataException, Format("Replay round has {0} inputs, not a multiple of {1} players")
+                    << round.inputs.size() << players);
+        }
+        if (!round.inputs.empty()) {
+            file.read(round.inputs.data(), 1, round.inputs.size());
+        }
+
+        round.keyframes.resize(readCount(file, fileSize, 2 * sizeof(Uint32)));
+        for (Keyframe &keyframe : round.keyframes) {
+            keyframe.tick = readValue<Uint32>(file);
+            keyframe.checksum = readValue<Uint32>(file);
+        }
+
+        return round;
+    }
+
+    Replay::Replay() {
+        clear();
+    }
+
+    void Replay::clear() {
+        playerNames.clear();
+        gameMode.clear();
+        maxRounds = 0;
+        quickLiquid = false;
+        globalAssistances = false;
+        ghostMode = false;
+        shotCollision = ShotCollisionSetting::Large;
+        ammoRange = std::make_pair(0, 0);
+        enabledWeapons = 0;
+        rounds.clear();
+    }
+
+    void Replay::setSettings(const std::string &gameMode, const GameSettings &settings) {
+        this->gameMode = gameMode;
+        maxRounds = settings.getMaxRounds();
+        quickLiquid = settings.isQuickLiquid();
+        globalAssistances = settings.isGlobalAssistances();
+        ghostMode = settings.isGhostEnabled();
+        shotCollision = settings.getShotCollision();
+        ammoRange = settings.getAmmoRange();
+
+        enabledWeapons = 0;
+        const auto &weapons = Weapon::values();
+        for (Size i = 0; i < weapons.size(); i++) {
+            if (settings.isWeaponEnabled(weapons[i])) {
+                enabledWeapons |= 1u << i;
+            }
+        }
+    }
+
+    void Replay::applySettings(GameSettings &settings) const {
+        settings.setMaxRounds(maxRounds);
+        settings.setQuickLiquid(quickLiquid);
+        settings.setGlobalAssistances(globalAssistances);
+        settings.setGhostEnabled(ghostMode);
+        settings.setShotCollision(shotCollision);
+        settings.setAmmoRange(ammoRange);
+
+        const auto &weapons = Weapon::values();
+        for (Size i = 0; i < weapons.size(); i++) {
+            settings.enableWeapon(weapons[i], (enabledWeapons & (1u << i)) != 0);
+        }
+    }
+
+    Replay::Round &Replay::addRound(Uint32 seed, const std::string &level, bool mirror) {
+        rounds.push_back(Round(seed, level, mirror, playerNames.size()));
+        return rounds.back();
+    }
+
+    Uint32 Replay::getTicks() const {
+        Uint32 ticks = 0;
+        for (const Round &round : rounds) {
+            ticks += round.getTicks();
+        }
+        return ticks;
+    }
+
+    void Replay::save(const std::string &path) const {
+        File file(path, File::Mode::Binary, File::Access::Write);
+        file.write(REPLAY_MAGIC, 1, sizeof(REPLAY_MAGIC));
+        writeValue(file, REPLAY_VERSION);
+        writeValue(file, KEYFRAME_INTERVAL);
+        writeString(file, gameMode);
+        writeValue(file, maxRounds);
+        writeValue(file, Uint8(quickLiquid ? 1 : 0));
+        writeValue(file, Uint8(globalAssistances ? 1 : 0));
+        writeValue(file, Uint8(ghostMode ? 1 : 0));
+        writeValue(file, Uint8(shotCollision));
+        writeValue(file, ammoRange.first);
+        writeValue(file, ammoRange.second);
+        writeValue(file, enabledWeapons);
+
+        writeValue(file, Uint32(playerNames.size()));
+        for (const std::string &name : playerNames) {
+            writeString(file, name);
+        }
+
+        writeValue(file, Uint32(rounds.size()));
+        for (const Round &round : rounds) {
+            round.save(file);
+        }
+    }
+
+    Replay Replay::load(const std::string &path) {
+        Size fileSize = File::getSize(path);
+        File file(path, File::Mode::Binary, File::Access::Read);
+        char magic[sizeof(REPLAY_MAGIC)];
+        file.read(magic, 1, sizeof(magic));
+        if (memcmp(magic, REPLAY_MAGIC, sizeof(magic)) != 0) {
+            D6_THROW(IoException, "Not a replay file: " + path);
+        }
+
+        Uint32 version = readValue<Uint32>(file);
+        Uint32 keyframeInterval = readValue<Uint32>(file);
+        if (version != REPLAY_VERSION || keyframeInterval != KEYFRAME_INTERVAL) {
+            D6_THROW(IoException, Format("Unsupported replay version {0} in file {1}") << version << path);
+        }
+
+        Replay replay;
+        replay.gameMode = readString(file, fileSize);
+        replay.maxRounds = readValue<Int32>(file);
+        replay.quickLiquid = readValue<Uint8>(file) != 0;
+        replay.globalAssistances = readValue<Uint8>(file) != 0;
+        replay.ghostMode = readValue<Uint8>(file) != 0;
+        replay.shotCollision = ShotCollisionSetting(readValue<Uint8>(file));
+        replay.ammoRange.first = readValue<Int32>(file);
+        replay.ammoRange.second = readValue<Int32>(file);
+        replay.enabledWeapons = readValue<Uint32>(file);
+
+        // Every name and round takes at least its 4 byte length or seed
+        replay.playerNames.resize(readCount(file, fileSize, sizeof(Uint32)));
+        if (replay.playerNames.empty()) {
+            D6_THROW(DataException, "Replay has no players: " + path);
+        }
+        for (std::string &name : replay.playerNames) {
+            name = readString(file, fileSize);
+        }
+
+        Size rounds = readCount(file, fileSize, sizeof(Uint32));
+        for (Size i = 0; i < rounds; i++) {
+            replay.rounds.push_back(Round::load(file, fileSize, replay.playerNames.size()));
+        }
+
+        return replay;
+    }
+
+    Uint32 Replay::checksum(const World &world) {
+        Fnv1a hash;
+        for (const Player &player : world.getPlayers()) {
+            const Vector &position = player.getPosition();
+            hash.add(position.x).add(position.y);
+            hash.add(player.getLife()).add(player.getAir()).add(player.getAmmo());
+            hash.add(player.isAlive()).add(player.getRoundKills());
+        }
+
+        world.getShotList().forEach([&hash](const Shot &shot) {
+            Vector centre = shot.getCentre();
+            hash.add(centre.x).add(centre.y);
+            return true;
+        });
+
+        hash.add(world.getLevel().getWaterLevel());
+        return hash.get();
+    }
+}
@@ -0,0 +1,162 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef DUEL6_REPLAY_H
+#define DUEL6_REPLAY_H
+
+#include <string>
+#include <vector>
+#include "Type.h"
+#include "Defines.h"
+#include "File.h"
+#include "GameSettings.h"
+
+namespace Duel6 {
+    class World;
+
+    /**
+     * Recording of a game that can be simulated again with identical results. Each round stores its random seed,
+     * level, mirror flag and the controller state of every player for every tick. Checksums of the world state are
+     * stored at regular keyframes so that a diverging simulation is detected. Keyframes hold no world state, playback
+     * always starts at the beginning of the game.
+     */
+    class Replay {
+    public:
+        /** One checksum keyframe per simulated second */
+        static const Uint32 KEYFRAME_INTERVAL = D6_UPDATE_FREQUENCY;
+
+        struct Keyframe {
+            Uint32 tick;
+            Uint32 checksum;
+        };
+
+        class Round {
+        private:
+            Uint32 seed;
+            std::string level;
+            bool mirror;
+            Size players;
+            std::vector<Uint8> inputs;
+            std::vector<Keyframe> keyframes;
+
+        public:
+            Round(Uint32 seed, const std::string &level, bool mirror, Size players);
+
+            Uint32 getSeed() const {
+                return seed;
+            }
+
+            const std::string &getLevel() const {
+                return level;
+            }
+
+            bool isMirror() const {
+                return mirror;
+            }
+
+            Uint32 getTicks() const {
+                return players > 0 ? Uint32(inputs.size() / players) : 0;
+            }
+
+            /** Inputs have a fixed size so the input of any tick is found without decoding the previous ones */
+            Uint32 getInput(Uint32 tick, Size player) const {
+                return inputs[tick * players + player];
+            }
+
+            void addInput(Uint32 controllerState) {
+                inputs.push_back(Uint8(controllerState));
+            }
+
+            const std::vector<Keyframe> &getKeyframes() const {
+                return keyframes;
+            }
+
+            void addKeyframe(Uint32 tick, Uint32 checksum) {
+                keyframes.push_back({tick, checksum});
+            }
+
+            /** Returns the last keyframe at or before the given tick or nullptr */
+            const Keyframe *findKeyframe(Uint32 tick) const;
+
+            void save(File &file) const;
+
+            /** Counts are checked against the remaining bytes of the file and the number of players */
+            static Round load(File &file, Size fileSize, Size playerCount);
+        };
+
+    private:
+        std::vector<std::string> playerNames;
+        std::string gameMode;
+        Int32 maxRounds;
+        bool quickLiquid;
+        bool globalAssistances;
+        bool ghostMode;
+        ShotCollisionSetting shotCollision;
+        std::pair<Int32, Int32> ammoRange;
+        Uint32 enabledWeapons;
+        std::vector<Round> rounds;
+
+    public:
+        Replay();
+
+        void clear();
+
+        /** Remembers all settings that influence the simulation */
+        void setSettings(const std::string &gameMode, const GameSettings &settings);
+
+        void applySettings(GameSettings &settings) const;
+
+        const std::string &getGameMode() const {
+            return gameMode;
+        }
+
+        const std::vector<std::string> &getPlayerNames() const {
+            return playerNames;
+        }
+
+        void addPlayer(const std::string &name) {
+            playerNames.push_back(name);
+        }
+
+        Round &addRound(Uint32 seed, const std::string &level, bool mirror);
+
+        const std::vector<Round> &getRounds() const {
+            return rounds;
+        }
+
+        Uint32 getTicks() const;
+
+        void save(const std::string &path) const;
+
+        static Replay load(const std::string &path);
+
+        /** Hashes the state of players, shots and water so that two simulations can be compared */
+        static Uint32 checksum(const World &world);
+    };
+}
+
+#endif
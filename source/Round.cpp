@@ -36,10 +36,9 @@ namespace Duel6 {
     Round::Round(Game &game, Int32 roundNumber, const std::string &levelPath, bool mirror)
             : game(game), roundNumber(roundNumber), world(game, levelPath, mirror),
               suddenDeathMode(false), waterFillWait(0), showYouAreHere(D6_YOU_ARE_HERE_DURATION), gameOverWait(0),
-              winner(false), scriptContext(world) {}
+              ticks(0), winner(false), scriptContext(world), replayRecording(nullptr), replayPlayback(nullptr) {}
 
     void Round::start() {
-        startTime = SDL_GetTicks();
         auto &players = world.getPlayers();
         game.getMode().initializePlayerPositions(game, players, world);
         setPlayerViews();
@@ -70,8 +69,13 @@ namespace Duel6 {
         }
     }
 
+    Uint32 Round::getRoundTime() const {
+        // Scripts see simulated time so that they behave the same regardless of the frame rate
+        return Uint32(Uint64(ticks) * 1000 / D6_UPDATE_FREQUENCY);
+    }
+
     void Round::scriptUpdate(Player &player) {
-        Uint32 roundTime = SDL_GetTicks() - startTime;
+        Uint32 roundTime = getRoundTime();
         PersonProfile *profile = player.getPerson().getProfile();
         if (profile != nullptr) {
             auto &personScripts = profile->getScripts();
@@ -82,7 +86,7 @@ namespace Duel6 {
     }
 
     void Round::scriptEnd() {
-        Uint32 roundTime = SDL_GetTicks() - startTime;
+        Uint32 roundTime = getRoundTime();
         auto &players = world.getPlayers();
         for (auto &player : players) {
             PersonProfile *profile = player.getPerson().getProfile();
@@ -177,9 +181,18 @@ namespace Duel6 {
             }
         }
 
-        for (Player &player : world.getPlayers()) {
-            player.updateControllerStatus();
-            scriptUpdate(player);
+        std::vector<Player> &players = world.getPlayers();
+        for (Size i = 0; i < players.size(); i++) {
+            Player &player = players[i];
+            if (replayPlayback != nullptr) {
+                player.setControllerState(isReplayExhausted() ? 0 : replayPlayback->getInput(ticks, i));
+            } else {
+                player.updateControllerStatus();
+                scriptUpdate(player);
+            }
+            if (replayRecording != nullptr) {
+                replayRecording->addInput(player.getControllerState());
+            }
             player.update(world, game.getSettings().getScreenMode(), elapsedTime);
             if (game.getSettings().isGhostEnabled() && !player.isInGame() && !player.isGhost()) {
                 player.makeGhost();
@@ -187,7 +200,6 @@ namespace Duel6 {
         }
 
         world.update(elapsedTime);
-        game.getAppService().getVideo().getRenderer().setGlobalTime(world.getTime());
 
         if (suddenDeathMode) {
             waterFillWait += elapsedTime;
@@ -198,6 +210,28 @@ namespace Duel6 {
         }
 
         showYouAreHere = std::max(showYouAreHere - 3 * elapsedTime, 0.0f);
+
+        ticks++;
+        checkKeyframe();
+    }
+
+    void Round::checkKeyframe() {
+        if (ticks % Replay::KEYFRAME_INTERVAL != 0 || (replayRecording == nullptr && replayPlayback == nullptr)) {
+            return;
+        }
+
+        Uint32 checksum = Replay::checksum(world);
+        if (replayRecording != nullptr) {
+            replayRecording->addKeyframe(ticks, checksum);
+        }
+
+        if (replayPlayback != nullptr) {
+            const Replay::Keyframe *keyframe = replayPlayback->findKeyframe(ticks);
+            if (keyframe != nullptr && keyframe->tick == ticks && keyframe->checksum != checksum) {
+                D6_THROW(GameException, Format("Replay desynchronized in round {0} at tick {1}")
+                        << (roundNumber + 1) << ticks);
+            }
+        }
     }
 
     void Round::keyEvent(const KeyPressEvent &event) {
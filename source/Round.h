@@ -33,6 +33,7 @@
 #include "Player.h"
 #include "World.h"
 #include "SysEvent.h"
+#include "Replay.h"
 
 namespace Duel6 {
     class Game;
@@ -46,11 +47,13 @@ namespace Duel6 {
         Float32 waterFillWait;
         Float32 showYouAreHere;
         Float32 gameOverWait;
-        Uint32 startTime;
+        Uint32 ticks;
         bool winner;
         std::vector<Player *> alivePlayers;
         Script::RoundScriptContext scriptContext;
         std::function<void()> onRoundEnd;
+        Replay::Round *replayRecording;
+        const Replay::Round *replayPlayback;
 
     public:
         Round(Game &game, Int32 roundNumber, const std::string &levelPath, bool mirror);
@@ -63,6 +66,10 @@ namespace Duel6 {
 
         void keyEvent(const KeyPressEvent &event);
 
+        World &getWorld() {
+            return world;
+        }
+
         const World &getWorld() const {
             return world;
         }
@@ -91,6 +98,24 @@ namespace Duel6 {
             onRoundEnd = callback;
         }
 
+        /** Stores the controller state of all players and keyframe checksums in the given replay round */
+        void setReplayRecording(Replay::Round *recording) {
+            replayRecording = recording;
+        }
+
+        /** Drives the players by the recorded controller states instead of their controls and scripts */
+        void setReplayPlayback(const Replay::Round *playback) {
+            replayPlayback = playback;
+        }
+
+        bool isReplayExhausted() const {
+            return replayPlayback != nullptr && ticks >= replayPlayback->getTicks();
+        }
+
+        Uint32 getTicks() const {
+            return ticks;
+        }
+
     private:
         void scriptStart();
 
@@ -100,6 +125,10 @@ namespace Duel6 {
 
         void checkWinner();
 
+        void checkKeyframe();
+
+        Uint32 getRoundTime() const;
+
         void setPlayerViews();
 
         void splitScreenView(Player &player, Int32 x, Int32 y);
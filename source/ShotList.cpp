@@ -25,44 +25,92 @@
 * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <algorithm>
 #include "ShotList.h"
 #include "World.h"
 #include "Weapon.h"
 #include "Player.h"
 
 namespace Duel6 {
-    ShotList::ShotList() {}
+    ShotList::ShotList(Int32 levelWidth, Int32 levelHeight)
+            : nextSequence(0), shotGrid(levelWidth, levelHeight, GRID_CELL_SIZE),
+              playerGrid(levelWidth, levelHeight, GRID_CELL_SIZE) {}
 
-    void ShotList::addShot(ShotPointer &&shot) {
-        shots.push_back(std::forward<ShotPointer>(shot));
+    void ShotList::updateCells(Entry &entry, const Rectangle &rect) {
+        SpatialGridCells cells = shotGrid.getCells(rect);
+        if (cells.left != entry.cells.left || cells.right != entry.cells.right ||
+            cells.bottom != entry.cells.bottom || cells.top != entry.cells.top) {
+            shotGrid.remove(&entry, entry.cells);
+            shotGrid.insert(&entry, cells);
+            entry.cells = cells;
+        }
+    }
+
+    Shot *ShotList::get(const ShotHandle &handle) {
+        if (handle.pool >= pools.size() || !pools[handle.pool]) {
+            return nullptr;
+        }
+        return pools[handle.pool]->get(handle.slot, handle.generation);
     }
 
     void ShotList::update(World &world, Float32 elapsedTime) {
-        auto iter = shots.begin();
+        // Players do not move while shots are updated
+        playerGrid.clear();
+        for (Player &player : world.getPlayers()) {
+            playerGrid.insert(&player, playerGrid.getCells(player.getCollisionRect()));
+        }
 
-        while (iter != shots.end()) {
-            Shot &shot = *iter->get();
-            if (!shot.update(elapsedTime, world)) {
-                iter = shots.erase(iter);
-            } else {
-                ++iter;
+        // Shots fired during the update are appended and updated in the same tick
+        Size liveShots = 0;
+        for (Size i = 0; i < shots.size(); i++) {
+            Entry *entry = shots[i];
+            if (entry->pool->update(entry->slot, *this, world, elapsedTime)) {
+                shots[liveShots++] = entry;
             }
         }
+        shots.resize(liveShots);
     }
 
     void ShotList::forEach(std::function<bool(const Shot &)> handler) const {
-        for (auto &shotPointer : shots) {
-            if (!handler(*shotPointer)) {
+        for (const Entry *entry : shots) {
+            if (!handler(*entry->shot)) {
                 break;
             }
         }
     }
 
     void ShotList::forEach(std::function<bool(Shot &)> handler) {
-        for (auto &shotPointer : shots) {
-            if (!handler(*shotPointer)) {
+        for (Entry *entry : shots) {
+            if (!handler(*entry->shot)) {
                 break;
             }
         }
     }
-}
\ No newline at end of file
+
+    const std::vector<Shot *> &ShotList::findShots(const Rectangle &rect) {
+        nearEntries.clear();
+        shotGrid.query(shotGrid.getCells(rect), nearEntries);
+
+        // Keep the order of the full list so that the first colliding shot stays the same
+        std::sort(nearEntries.begin(), nearEntries.end(), [](const Entry *left, const Entry *right) {
+            return left->sequence < right->sequence;
+        });
+        nearEntries.erase(std::unique(nearEntries.begin(), nearEntries.end()), nearEntries.end());
+
+        nearShots.clear();
+        for (Entry *entry : nearEntries) {
+            nearShots.push_back(entry->shot);
+        }
+        return nearShots;
+    }
+
+    const std::vector<Player *> &ShotList::findPlayers(const Rectangle &rect) {
+        nearPlayers.clear();
+        playerGrid.query(playerGrid.getCells(rect), nearPlayers);
+
+        // Players are stored in a vector so the address order is the order of the list
+        std::sort(nearPlayers.begin(), nearPlayers.end());
+        nearPlayers.erase(std::unique(nearPlayers.begin(), nearPlayers.end()), nearPlayers.end());
+        return nearPlayers;
+    }
+}
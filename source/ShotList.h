@@ -29,31 +29,188 @@
 #define DUEL6_SHOTLIST_H
 
 #include <memory>
-#include <list>
+#include <vector>
 #include <functional>
+#include <type_traits>
 #include "Shot.h"
 #include "Orientation.h"
+#include "collision/SpatialGrid.h"
 
 namespace Duel6 {
     class World;
 
+    /** Identifies a shot in its pool, the handle of a removed shot is recognized by an older generation */
+    struct ShotHandle {
+        Uint32 pool;
+        Uint32 slot;
+        Uint32 generation;
+    };
+
+    /**
+     * Shots are kept in one pool per shot type. A pool allocates shots in chunks of slots that never move, so
+     * firing does not allocate once the pool has grown. Shots are updated in the order in which they were fired,
+     * the pool calls the concrete shot type directly.
+     */
     class ShotList {
+    public:
+        /** Shots are small and travel well below one block per tick, players occupy about one block */
+        static constexpr Float32 GRID_CELL_SIZE = 2.0f;
+
     private:
-        typedef std::unique_ptr<Shot> ShotPointer;
+        class PoolBase;
+
+        struct Entry {
+            Shot *shot;
+            Uint64 sequence;
+            SpatialGridCells cells;
+            PoolBase *pool;
+            Uint32 slot;
+        };
+
+        class PoolBase {
+        public:
+            virtual ~PoolBase() {}
+
+            /** Updates the shot in the slot, a shot that is done is removed and false returned */
+            virtual bool update(Uint32 slot, ShotList &shotList, World &world, Float32 elapsedTime) = 0;
+
+            virtual Shot *get(Uint32 slot, Uint32 generation) = 0;
+        };
+
+        template<class T>
+        class Pool : public PoolBase {
+        private:
+            static const Uint32 CHUNK_SIZE = 256;
+
+            struct Slot {
+                Entry entry;
+                Uint32 generation = 0;
+                bool used = false;
+                typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+                T &getShot() {
+                    return *reinterpret_cast<T *>(&storage);
+                }
+            };
+
+        private:
+            std::vector<std::unique_ptr<Slot[]>> chunks;
+            std::vector<Uint32> freeSlots;
+            Uint32 capacity = 0;
+
+        public:
+            ~Pool() override {
+                for (Uint32 i = 0; i < capacity; i++) {
+                    Slot &slot = getSlot(i);
+                    if (slot.used) {
+                        slot.getShot().~T();
+                    }
+                }
+            }
+
+            template<class... Args>
+            Uint32 add(Args &&... args) {
+                if (freeSlots.empty()) {
+                    chunks.push_back(std::unique_ptr<Slot[]>(new Slot[CHUNK_SIZE]));
+                    for (Uint32 i = CHUNK_SIZE; i > 0; i--) {
+                        freeSlots.push_back(capacity + i - 1);
+                    }
+                    capacity += CHUNK_SIZE;
+                }
+
+                Uint32 index = freeSlots.back();
+                Slot &slot = getSlot(index);
+                new(&slot.storage) T(std::forward<Args>(args)...);
+                freeSlots.pop_back();
+                slot.used = true;
+                return index;
+            }
+
+            Slot &getSlot(Uint32 index) {
+                return chunks[index / CHUNK_SIZE][index % CHUNK_SIZE];
+            }
+
+            bool update(Uint32 index, ShotList &shotList, World &world, Float32 elapsedTime) override {
+                // Qualified calls on the concrete type are resolved at compile time
+                Slot &slot = getSlot(index);
+                T &shot = slot.getShot();
+                if (shot.T::update(elapsedTime, world)) {
+                    shotList.updateCells(slot.entry, shot.T::getCollisionRect());
+                    return true;
+                }
+                shotList.shotGrid.remove(&slot.entry, slot.entry.cells);
+                remove(index);
+                return false;
+            }
+
+            Shot *get(Uint32 index, Uint32 generation) override {
+                if (index >= capacity) {
+                    return nullptr;
+                }
+                Slot &slot = getSlot(index);
+                return (slot.used && slot.generation == generation) ? &slot.getShot() : nullptr;
+            }
+
+        private:
+            void remove(Uint32 index) {
+                Slot &slot = getSlot(index);
+                slot.getShot().~T();
+                slot.used = false;
+                slot.generation++;
+                freeSlots.push_back(index);
+            }
+        };
 
     private:
-        std::list<ShotPointer> shots;
+        std::vector<std::unique_ptr<PoolBase>> pools;
+        // Live shots in the order in which they were fired
+        std::vector<Entry *> shots;
+        Uint64 nextSequence;
+        SpatialGrid<Entry> shotGrid;
+        SpatialGrid<Player> playerGrid;
+        std::vector<Entry *> nearEntries;
+        std::vector<Shot *> nearShots;
+        std::vector<Player *> nearPlayers;
 
     public:
-        ShotList();
+        ShotList(Int32 levelWidth, Int32 levelHeight);
 
-        void addShot(ShotPointer &&shot);
+        /** Constructs a shot of type T in the given pool, all shots of one pool must have the same type */
+        template<class T, class... Args>
+        ShotHandle addShot(Size pool, Args &&... args) {
+            if (pools.size() <= pool) {
+                pools.resize(pool + 1);
+            }
+            if (!pools[pool]) {
+                pools[pool] = std::make_unique<Pool<T>>();
+            }
+
+            Pool<T> &shotPool = static_cast<Pool<T> &>(*pools[pool]);
+            Uint32 index = shotPool.add(std::forward<Args>(args)...);
+            auto &slot = shotPool.getSlot(index);
+            slot.entry = {&slot.getShot(), nextSequence++, SpatialGridCells(), &shotPool, index};
+            updateCells(slot.entry, slot.getShot().getCollisionRect());
+            shots.push_back(&slot.entry);
+            return {Uint32(pool), index, slot.generation};
+        }
+
+        /** Returns the shot or nullptr if it has been removed */
+        Shot *get(const ShotHandle &handle);
 
         void update(World &world, Float32 elapsedTime);
 
         void forEach(std::function<bool(const Shot &)> handler) const;
 
         void forEach(std::function<bool(Shot &)> handler);
+
+        /** Shots whose cells overlap the rectangle in the order in which they were fired, valid until the next call */
+        const std::vector<Shot *> &findShots(const Rectangle &rect);
+
+        /** Players whose cells overlap the rectangle in the order of the player list, valid until the next call */
+        const std::vector<Player *> &findPlayers(const Rectangle &rect);
+
+    private:
+        void updateCells(Entry &entry, const Rectangle &rect);
     };
 }
 
@@ -0,0 +1,92 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include "SimulationThread.h"
+
+namespace Duel6 {
+    SimulationThread::SimulationThread(Context &context, Float64 updateTime)
+            : context(context), updateTime(updateTime), running(true),
+              lastUpdateTime(std::chrono::steady_clock::now().time_since_epoch().count()) {
+        thread = std::thread([this]() {
+            run();
+        });
+    }
+
+    SimulationThread::~SimulationThread() {
+        running = false;
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    void SimulationThread::stop() {
+        running = false;
+        if (thread.joinable()) {
+            thread.join();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    Float32 SimulationThread::getInterpolation() const {
+        typedef std::chrono::steady_clock Clock;
+        Clock::duration elapsed = Clock::now().time_since_epoch() - Clock::duration(lastUpdateTime.load());
+        return Float32(std::min(std::max(std::chrono::duration<Float64>(elapsed).count() / updateTime, 0.0), 1.0));
+    }
+
+    void SimulationThread::run() {
+        typedef std::chrono::steady_clock Clock;
+        Clock::time_point lastTime = Clock::now();
+        Float64 accumulatedTime = 0;
+
+        try {
+            while (running) {
+                Clock::time_point curTime = Clock::now();
+                accumulatedTime += std::chrono::duration<Float64>(curTime - lastTime).count();
+                lastTime = curTime;
+
+                while (accumulatedTime > updateTime && running) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (context.isClosed()) {
+                        running = false;
+                        break;
+                    }
+                    context.update(Float32(updateTime));
+                    accumulatedTime -= updateTime;
+                    lastUpdateTime = Clock::now().time_since_epoch().count();
+                }
+
+                std::this_thread::sleep_for(std::chrono::duration<Float64>(updateTime - accumulatedTime));
+            }
+        } catch (...) {
+            error = std::current_exception();
+            running = false;
+        }
+    }
+}
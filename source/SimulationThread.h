@@ -0,0 +1,83 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef DUEL6_SIMULATIONTHREAD_H
+#define DUEL6_SIMULATIONTHREAD_H
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include "Type.h"
+#include "Context.h"
+
+namespace Duel6 {
+    /**
+     * Updates a context at a fixed rate on its own thread until the context is closed. Every update holds
+     * the mutex, other threads lock it to deliver events to the context.
+     */
+    class SimulationThread {
+    private:
+        Context &context;
+        Float64 updateTime;
+        std::mutex mutex;
+        std::atomic<bool> running;
+        std::atomic<std::chrono::steady_clock::rep> lastUpdateTime;
+        std::exception_ptr error;
+        std::thread thread;
+
+    public:
+        SimulationThread(Context &context, Float64 updateTime);
+
+        ~SimulationThread();
+
+        SimulationThread(const SimulationThread &) = delete;
+
+        SimulationThread &operator=(const SimulationThread &) = delete;
+
+        std::mutex &getMutex() {
+            return mutex;
+        }
+
+        /** False once the context is closed or an update failed */
+        bool isRunning() const {
+            return running;
+        }
+
+        /** Fraction of the next update that has elapsed since the last one, between 0 and 1 */
+        Float32 getInterpolation() const;
+
+        /** Waits for the thread to finish and rethrows the exception of a failed update */
+        void stop();
+
+    private:
+        void run();
+    };
+}
+
+#endif
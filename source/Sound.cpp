@@ -59,7 +59,7 @@ namespace Duel6 {
     }
 
     Sound::Sound(Int32 channels, Console &console)
-            : console(console), channels(channels), playing(false) {
+            : console(console), channels(channels), enabled(true), playing(false) {
         console.printLine("\n===Initialization of sound sub-system===");
         console.printLine("...Starting SDL_mixer library");
 
@@ -78,7 +78,17 @@ namespace Duel6 {
         console.print(Format("...Frequency: {0}\n...Channels: {1}\n") << MIX_DEFAULT_FREQUENCY << channels);
     }
 
+    Sound::Sound(Console &console)
+            : console(console), channels(0), enabled(false), playing(false) {
+        console.printLine("\n===Initialization of sound sub-system===");
+        console.printLine("...Sound disabled");
+    }
+
     Sound::~Sound() {
+        if (!enabled) {
+            return;
+        }
+
         // Stop and free modules
         stopMusic();
 
@@ -100,6 +110,10 @@ namespace Duel6 {
     }
 
     Sound::Track Sound::loadModule(const std::string &fileName) {
+        if (!enabled) {
+            return Track();
+        }
+
         Mix_Music *module = Mix_LoadMUS(fileName.c_str());
         if (module == nullptr) {
             D6_THROW(SoundException,
@@ -111,6 +125,10 @@ namespace Duel6 {
     }
 
     Sound::Sample Sound::loadSample(const std::string &fileName) {
+        if (!enabled) {
+            return Sample();
+        }
+
         Mix_Chunk *sample = Mix_LoadWAV(fileName.c_str());
         if (sample == nullptr) {
             D6_THROW(SoundException,
@@ -148,6 +166,10 @@ namespace Duel6 {
     }
 
     void Sound::volume(Int32 volume) {
+        if (!enabled) {
+            return;
+        }
+
         console.printLine(Format("...Volume set to {0}") << volume);
         Mix_VolumeMusic(volume);
         Mix_Volume(-1, volume);
@@ -77,6 +77,7 @@ namespace Duel6 {
     private:
         Console &console;
         Int32 channels;
+        bool enabled;
         bool playing;
         std::vector<Mix_Music *> modules;
         std::vector<Mix_Chunk *> samples;
@@ -84,6 +85,9 @@ namespace Duel6 {
     public:
         Sound(Int32 channels, Console &console);
 
+        /** Sound sub-system without an audio device, all samples and modules stay silent */
+        explicit Sound(Console &console);
+
         ~Sound();
 
         Track loadModule(const std::string &fileName);
@@ -94,6 +98,10 @@ namespace Duel6 {
 
         void stopMusic();
 
+        bool isEnabled() const {
+            return enabled;
+        }
+
     private:
         void startMusic(Mix_Music *music, bool loop);
 
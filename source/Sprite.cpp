@@ -29,7 +29,7 @@
 #include "Video.h"
 
 namespace Duel6 {
-    Sprite::Sprite(Animation animation, Texture texture) {
+    Sprite::Sprite(Animation animation, Texture texture, Uint32 slot) {
         this->animation = animation;
         this->texture = texture;
         frame = 0;
@@ -43,13 +43,10 @@ namespace Duel6 {
         size = Vector(1.0f, 1.0f);
         grow = 0;
         alpha = 1.0f;
-        zRotation = 0;
+        rotated = false;
+        snapshotted = false;
         blendFunc = BlendFunc::None;
-    }
-
-    Sprite Sprite::setOnFinished(std::function<FinishCallback> callback) {
-        onFinished = std::move(callback);
-        return *this;
+        this->slot = slot;
     }
 
     Sprite &Sprite::setPosition(const Vector &position, Float32 z) {
@@ -125,7 +122,8 @@ namespace Duel6 {
         return *this;
     }
 
-    void Sprite::update(float elapsedTime) {
+    bool Sprite::update(float elapsedTime) {
+        bool justFinished = false;
         delay += elapsedTime * speed * 1000;
         if (delay >= animation[frame + 1]) {
             frame += 2;
@@ -133,9 +131,7 @@ namespace Duel6 {
             if (animation[frame] == -1) {
                 if (!finished) {
                     finished = true;
-                    if (onFinished) {
-                        onFinished();
-                    }
+                    justFinished = true;
                 }
 
                 if (looping == AnimationLooping::RepeatForever) {
@@ -151,9 +147,11 @@ namespace Duel6 {
             position -= growStep;
             size += 2 * growStep;
         }
+
+        return justFinished;
     }
 
-    void Sprite::render(Renderer &renderer) const {
+    void Sprite::render(Renderer &renderer, Float32 interpolation) const {
         if (!visible) {
             return;
         }
@@ -168,22 +166,13 @@ namespace Duel6 {
         Int32 textureIndex = animation[frame];
         Material material(texture, Color(255, 255, 255, Uint8(255 * alpha)), !isTransparent());
 
-        bool rotated = zRotation != 0.0;
-        if (rotated) {
-            Matrix rotate = Matrix::rotateAroundPoint(zRotation, Vector::UNIT_Z, position + rotationCentre);
-            renderer.setModelMatrix(rotate);
-        }
-
         bool reversed = (orientation == Orientation::Right);
         Vector texturePos = Vector(reversed ? 1.0f : 0.0f, 1.0f, Float32(textureIndex));
         Vector textureSize = Vector(reversed ? -1.0f : 1.0f, -1.0f);
 
+        Vector position = getInterpolatedPosition(interpolation);
         renderer.quadXY(Vector(position.x, position.y, z), size, texturePos, textureSize, material);
 
-        if (rotated) {
-            renderer.setModelMatrix(Matrix::IDENTITY);
-        }
-
         if (isNoDepth()) {
             renderer.enableDepthTest(true);
         }
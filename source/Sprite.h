@@ -39,12 +39,13 @@
 namespace Duel6 {
     class SpriteList;
 
+    /**
+     * Data touched by every update and render. Finish callbacks and rotation are rarely used and are kept
+     * by SpriteList aside of the sprites.
+     */
     class Sprite {
         friend class SpriteList;
 
-    public:
-        using FinishCallback = void();
-
     private:
         Animation animation;    // Source array of animations and delays
         Texture texture;   // Texture array
@@ -54,6 +55,7 @@ namespace Duel6 {
         AnimationLooping looping;   // Type of looping
         Orientation orientation;   // Current orientation
         Vector position;
+        Vector previousPosition;    // Position in the previous game snapshot
         Float32 z;
         Vector size;
         Float32 grow;   // Grow factor for explosions
@@ -62,14 +64,12 @@ namespace Duel6 {
         bool visible;
         bool noDepth;
         bool finished;
-        Float32 zRotation;
-        Vector rotationCentre;
-        std::function<FinishCallback> onFinished;
+        bool rotated;
+        bool snapshotted;   // The sprite has been in a snapshot, previousPosition is valid
+        Uint32 slot;    // Slot of the sprite in its SpriteList
 
     public:
-        Sprite(Animation animation, Texture texture);
-
-        Sprite setOnFinished(std::function<FinishCallback> callback);
+        Sprite(Animation animation, Texture texture, Uint32 slot);
 
         Sprite &setPosition(const Vector &position, Float32 z);
 
@@ -107,12 +107,6 @@ namespace Duel6 {
 
         Sprite &setNoDepth(bool depth);
 
-        Sprite &setZRotation(Float32 angle, Vector centre = Vector()) {
-            zRotation = angle;
-            rotationCentre = centre;
-            return *this;
-        }
-
         Size getFrame() const {
             return frame;
         }
@@ -133,9 +127,15 @@ namespace Duel6 {
             return noDepth;
         }
 
-        void update(Float32 elapsedTime);
+        /** Returns true when the animation has just finished */
+        bool update(Float32 elapsedTime);
 
-        void render(Renderer &renderer) const;
+        /** Interpolation between 0 and 1 places the sprite between its previous and current position */
+        void render(Renderer &renderer, Float32 interpolation) const;
+
+        Vector getInterpolatedPosition(Float32 interpolation) const {
+            return previousPosition + (position - previousPosition) * interpolation;
+        }
     };
 }
 
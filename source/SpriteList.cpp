@@ -26,47 +26,211 @@
 */
 
 #include "SpriteList.h"
+#include "Format.h"
+#include "GameException.h"
 #include "Video.h"
 
 namespace Duel6 {
-    SpriteList::Iterator SpriteList::add(Animation animation, Texture texture) {
-        sprites.emplace_back(animation, texture);
-        return std::prev(sprites.end());
+    SpriteList::Handle SpriteList::add(Animation animation, Texture texture) {
+        Uint32 slot;
+        if (freeSlots.empty()) {
+            slot = Uint32(slots.size());
+            slots.emplace_back();
+            coldData.emplace_back();
+        } else {
+            slot = freeSlots.back();
+            freeSlots.pop_back();
+        }
+
+        Slot &entry = slots[slot];
+        entry.used = true;
+        entry.transparent = false;
+        entry.index = Uint32(opaque.size());
+        opaque.emplace_back(animation, texture, slot);
+        return Handle(this, slot, entry.generation);
+    }
+
+    void SpriteList::remove(const Handle &handle) {
+        Sprite *sprite = handle.spriteList == this ? find(handle) : nullptr;
+        if (sprite == nullptr) {
+            return;
+        }
+
+        // The sprite stays in its array until the next compaction
+        sprite->slot = NO_SLOT;
+        Slot &entry = slots[handle.slot];
+        entry.used = false;
+        entry.generation++;
+        coldData[handle.slot] = ColdData();
+        freeSlots.push_back(handle.slot);
+    }
+
+    void SpriteList::clear() {
+        opaque.clear();
+        transparent.clear();
+        for (Uint32 slot = 0; slot < slots.size(); slot++) {
+            if (slots[slot].used) {
+                slots[slot].used = false;
+                slots[slot].generation++;
+                coldData[slot] = ColdData();
+                freeSlots.push_back(slot);
+            }
+        }
+    }
+
+    Sprite *SpriteList::find(const Handle &handle) {
+        if (handle.slot >= slots.size()) {
+            return nullptr;
+        }
+        const Slot &entry = slots[handle.slot];
+        if (!entry.used || entry.generation != handle.generation) {
+            return nullptr;
+        }
+        return &getArray(entry.transparent)[entry.index];
+    }
+
+    Sprite &SpriteList::get(const Handle &handle) {
+        Sprite *sprite = find(handle);
+        if (sprite == nullptr) {
+            D6_THROW(GameException, Format("Access to removed sprite {0}") << handle.slot);
+        }
+        return *sprite;
+    }
+
+    void SpriteList::setOnFinished(const Handle &handle, FinishCallback callback) {
+        get(handle);
+        coldData[handle.slot].onFinished = std::move(callback);
+    }
+
+    void SpriteList::setZRotation(const Handle &handle, Float32 angle, const Vector &centre) {
+        get(handle).rotated = angle != 0;
+        coldData[handle.slot].zRotation = angle;
+        coldData[handle.slot].rotationCentre = centre;
     }
 
     void SpriteList::update(Float32 elapsedTime) {
-        // Update everything
-        for (Sprite &sprite : sprites) {
-            sprite.update(elapsedTime);
+        updateArray(opaque, elapsedTime);
+        updateArray(transparent, elapsedTime);
+    }
+
+    void SpriteList::updateArray(std::vector<Sprite> &sprites, Float32 elapsedTime) {
+        // Finish callbacks may add sprites, so no reference into the array is kept across them
+        for (Size i = 0, count = sprites.size(); i < count; i++) {
+            Uint32 slot = sprites[i].slot;
+            if (slot == NO_SLOT) {
+                continue;
+            }
+
+            if (sprites[i].update(elapsedTime) && coldData[slot].onFinished) {
+                FinishCallback callback = coldData[slot].onFinished;
+                callback();
+            }
+
+            // Delete sprites with finished animations
+            if (sprites[i].slot == slot && sprites[i].getLooping() == AnimationLooping::OnceAndRemove &&
+                sprites[i].isFinished()) {
+                remove(Handle(this, slot, slots[slot].generation));
+            }
         }
+    }
 
-        // Delete sprites with finished animations
-        auto sprite = sprites.begin();
-        while (sprite != sprites.end()) {
-            if (sprite->getLooping() == AnimationLooping::OnceAndRemove && sprite->isFinished()) {
-                sprite = sprites.erase(sprite);
-            } else {
-                ++sprite;
+    void SpriteList::compact() {
+        moved.clear();
+        compactArray(opaque, false);
+        for (Sprite &sprite : moved) {
+            slots[sprite.slot].transparent = true;
+            transparent.push_back(sprite);
+        }
+
+        moved.clear();
+        compactArray(transparent, true);
+        for (Sprite &sprite : moved) {
+            slots[sprite.slot].transparent = false;
+            slots[sprite.slot].index = Uint32(opaque.size());
+            opaque.push_back(sprite);
+        }
+    }
+
+    void SpriteList::compactArray(std::vector<Sprite> &sprites, bool transparentArray) {
+        // Sprites keep their relative order so that the render order stays the same
+        Size count = 0;
+        for (Size i = 0; i < sprites.size(); i++) {
+            const Sprite &sprite = sprites[i];
+            if (sprite.slot == NO_SLOT) {
+                continue;
+            }
+            if (sprite.isTransparent() != transparentArray) {
+                moved.push_back(sprite);
+                continue;
+            }
+
+            if (count != i) {
+                sprites[count] = sprite;
             }
+            slots[sprite.slot].index = Uint32(count);
+            count++;
         }
+        sprites.erase(sprites.begin() + count, sprites.end());
     }
 
-    void SpriteList::render(Renderer &renderer) const {
-        renderTransparent(renderer, false);
+    void SpriteList::snapshot(Snapshot &snapshot) {
+        snapshot.rotations.clear();
+        snapshotArray(opaque, false, snapshot.opaque, snapshot.rotations);
+        snapshotArray(transparent, true, snapshot.transparent, snapshot.rotations);
+    }
+
+    void SpriteList::snapshotArray(std::vector<Sprite> &sprites, bool transparentArray, std::vector<Sprite> &copies,
+                                   std::vector<Snapshot::Rotation> &rotations) {
+        copies.clear();
+        for (Sprite &sprite : sprites) {
+            if (sprite.slot == NO_SLOT || sprite.isTransparent() != transparentArray) {
+                continue;
+            }
+
+            // New sprites appear at their current position
+            if (!sprite.snapshotted) {
+                sprite.previousPosition = sprite.position;
+                sprite.snapshotted = true;
+            }
+            Vector previousPosition = sprite.previousPosition;
+            sprite.previousPosition = sprite.position;
+            if (!sprite.visible) {
+                continue;
+            }
+
+            copies.push_back(sprite);
+            copies.back().previousPosition = previousPosition;
+            if (sprite.rotated) {
+                const ColdData &cold = coldData[sprite.slot];
+                copies.back().slot = Uint32(rotations.size());
+                rotations.push_back({cold.zRotation, cold.rotationCentre});
+            }
+        }
+    }
+
+    void SpriteList::render(Renderer &renderer, const Snapshot &snapshot, Float32 interpolation) {
+        renderArray(renderer, snapshot.opaque, snapshot.rotations, interpolation);
 
         renderer.enableDepthWrite(false);
 
-        renderTransparent(renderer, true);
+        renderArray(renderer, snapshot.transparent, snapshot.rotations, interpolation);
 
         renderer.enableDepthWrite(true);
         renderer.setBlendFunc(BlendFunc::None);
     }
 
-    void SpriteList::renderTransparent(Renderer &renderer, bool transparent) const {
+    void SpriteList::renderArray(Renderer &renderer, const std::vector<Sprite> &sprites,
+                                 const std::vector<Snapshot::Rotation> &rotations, Float32 interpolation) {
         for (const Sprite &sprite : sprites) {
-            if (sprite.isTransparent() == transparent) {
-                sprite.render(renderer);
+            if (sprite.rotated) {
+                const Snapshot::Rotation &rotation = rotations[sprite.slot];
+                Vector centre = sprite.getInterpolatedPosition(interpolation) + rotation.centre;
+                renderer.setModelMatrix(Matrix::rotateAroundPoint(rotation.angle, Vector::UNIT_Z, centre));
+                sprite.render(renderer, interpolation);
+                renderer.setModelMatrix(Matrix::IDENTITY);
+            } else {
+                sprite.render(renderer, interpolation);
             }
         }
     }
-}
\ No newline at end of file
+}
@@ -28,35 +28,137 @@
 #ifndef DUEL6_SPRITELIST_H
 #define DUEL6_SPRITELIST_H
 
-#include <list>
+#include <vector>
+#include <functional>
 #include "Sprite.h"
 
 namespace Duel6 {
+    /**
+     * Sprites are stored in two dense arrays, one for opaque and one for transparent sprites, so that update
+     * and render walk memory linearly. Sprites are referenced by generation checked handles that stay valid
+     * when sprites are moved within or between the arrays.
+     */
     class SpriteList {
     public:
-        typedef std::list<Sprite>::iterator Iterator;
+        using FinishCallback = std::function<void()>;
+
+        class Handle {
+            friend class SpriteList;
+
+        private:
+            SpriteList *spriteList;
+            Uint32 slot;
+            Uint32 generation;
+
+        public:
+            Handle()
+                    : spriteList(nullptr), slot(0), generation(0) {}
+
+            /** False if the handle is empty or the sprite has been removed */
+            bool isValid() const {
+                return spriteList != nullptr && spriteList->find(*this) != nullptr;
+            }
+
+            Sprite *operator->() const {
+                return &spriteList->get(*this);
+            }
+
+            Sprite &operator*() const {
+                return spriteList->get(*this);
+            }
+
+        private:
+            Handle(SpriteList *spriteList, Uint32 slot, Uint32 generation)
+                    : spriteList(spriteList), slot(slot), generation(generation) {}
+        };
 
     private:
-        std::list<Sprite> sprites;
+        static const Uint32 NO_SLOT = 0xFFFFFFFF;
+
+        struct Slot {
+            Uint32 generation = 0;
+            bool used = false;
+            bool transparent = false;
+            Uint32 index = 0;
+        };
+
+        struct ColdData {
+            FinishCallback onFinished;
+            Float32 zRotation = 0;
+            Vector rotationCentre;
+        };
+
+        std::vector<Sprite> opaque;
+        std::vector<Sprite> transparent;
+        std::vector<Slot> slots;
+        std::vector<ColdData> coldData;
+        std::vector<Uint32> freeSlots;
+        std::vector<Sprite> moved;
 
     public:
-        Iterator add(Animation animation, Texture texture);
+        /** Copy of the sprites that can be rendered while the list itself keeps changing */
+        struct Snapshot {
+            struct Rotation {
+                Float32 angle;
+                Vector centre;
+            };
 
-        void remove(Iterator iterator) {
-            sprites.erase(iterator);
-        }
+            std::vector<Sprite> opaque;
+            std::vector<Sprite> transparent;
+            // The slot of a rotated sprite in the snapshot is the index of its rotation
+            std::vector<Rotation> rotations;
+        };
 
-        void clear() {
-            sprites.clear();
-        }
+    public:
+        Handle add(Animation animation, Texture texture);
+
+        /** Removing an empty or already removed handle does nothing */
+        void remove(const Handle &handle);
+
+        void clear();
+
+        Sprite &get(const Handle &handle);
+
+        /** Called when the animation of the sprite reaches its end for the first time */
+        void setOnFinished(const Handle &handle, FinishCallback callback);
+
+        void setZRotation(const Handle &handle, Float32 angle, const Vector &centre = Vector());
 
         void update(Float32 elapsedTime);
 
-        void render(Renderer &renderer) const;
+        /**
+         * Drops removed sprites and moves sprites whose blending has changed to the other array. Must be called
+         * after all sprites of a tick have been added and updated, render skips sprites in the wrong array.
+         */
+        void compact();
+
+        /** Positions in the snapshot become the previous positions of the next one */
+        void snapshot(Snapshot &snapshot);
+
+        static void render(Renderer &renderer, const Snapshot &snapshot, Float32 interpolation);
+
+        /** Number of sprites including the removed ones until the next compaction */
+        Size size() const {
+            return opaque.size() + transparent.size();
+        }
 
     private:
-        void renderTransparent(Renderer &renderer, bool transparent) const;
+        Sprite *find(const Handle &handle);
+
+        std::vector<Sprite> &getArray(bool transparentArray) {
+            return transparentArray ? transparent : opaque;
+        }
+
+        void updateArray(std::vector<Sprite> &sprites, Float32 elapsedTime);
+
+        void compactArray(std::vector<Sprite> &sprites, bool transparentArray);
+
+        void snapshotArray(std::vector<Sprite> &sprites, bool transparentArray, std::vector<Sprite> &copies,
+                           std::vector<Snapshot::Rotation> &rotations);
+
+        static void renderArray(Renderer &renderer, const std::vector<Sprite> &sprites,
+                                const std::vector<Snapshot::Rotation> &rotations, Float32 interpolation);
     };
 }
 
-#endif
\ No newline at end of file
+#endif
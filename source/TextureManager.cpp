@@ -25,6 +25,7 @@
 * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <SDL2/SDL_image.h>
 #include <algorithm>
 #include "TextureManager.h"
 #include "File.h"
@@ -32,8 +33,42 @@
 #include "aseprite/animation.h"
 
 namespace Duel6 {
-    TextureManager::TextureManager(Renderer &renderer)
-            : renderer(renderer) {}
+    TextureManager::TextureManager(Renderer &renderer, JobSystem &jobSystem)
+            : renderer(renderer), jobSystem(jobSystem) {}
+
+    void TextureManager::decode(const std::vector<std::string> &paths) {
+        std::vector<std::string> files;
+        for (const std::string &path : paths) {
+            findImages(path, files);
+        }
+
+        // Dynamically loaded image libraries are initialized on first use, which must not happen on several threads
+        IMG_Init(IMG_INIT_PNG);
+
+        std::vector<Image> images(files.size());
+        JobSystem::Graph graph;
+        for (Size i = 0; i < files.size(); i++) {
+            graph.add([&files, &images, i]() {
+                images[i] = Image::load(files[i]);
+            });
+        }
+        jobSystem.run(graph);
+
+        for (Size i = 0; i < files.size(); i++) {
+            decodedImages[files[i]] = std::move(images[i]);
+        }
+    }
+
+    void TextureManager::findImages(const std::string &path, std::vector<std::string> &files) const {
+        for (const std::string &file : File::listDirectory(path)) {
+            std::string filePath = path + file;
+            if (File::isDirectory(filePath)) {
+                findImages(filePath + "/", files);
+            } else if (decodedImages.find(filePath) == decodedImages.end()) {
+                files.push_back(filePath);
+            }
+        }
+    }
 
     const animation::Animation TextureManager::loadAnimation(const std::string &path) {
         return animation::Animation::loadAseImage(path);
@@ -129,11 +164,40 @@ namespace Duel6 {
 
     Texture TextureManager::loadStack(const std::string &path, TextureFilter filtering, bool clamp,
                                       const SubstitutionTable &substitutionTable) {
-        Image image = Image::loadStack(path);
-        substituteColors(image, substitutionTable);
+        return createTexture(loadImageStack(path), filtering, clamp, substitutionTable);
+    }
 
-        Texture texture = renderer.createTexture(image, filtering, clamp);
-        return texture;
+    Texture TextureManager::createTexture(const Image &image, TextureFilter filtering, bool clamp,
+                                          const SubstitutionTable &substitutionTable) {
+        if (substitutionTable.empty()) {
+            return renderer.createTexture(image, filtering, clamp);
+        }
+
+        Image substituted = image;
+        substituteColors(substituted, substitutionTable);
+        return renderer.createTexture(substituted, filtering, clamp);
+    }
+
+    Image TextureManager::loadImageStack(const std::string &path) {
+        std::vector<std::string> textureFiles = File::listDirectory(path);
+        std::sort(textureFiles.begin(), textureFiles.end());
+
+        Image result;
+        for (const std::string &file : textureFiles) {
+            result.addSlice(loadImage(path + file));
+        }
+        return result;
+    }
+
+    Image TextureManager::loadImage(const std::string &path) {
+        auto decoded = decodedImages.find(path);
+        if (decoded == decodedImages.end()) {
+            return Image::load(path);
+        }
+
+        Image image = std::move(decoded->second);
+        decodedImages.erase(decoded);
+        return image;
     }
 
     const TextureDictionary TextureManager::loadDict(const std::string &path, TextureFilter filtering, bool clamp) {
@@ -141,7 +205,7 @@ namespace Duel6 {
 
         TextureDictionary dict;
         for (std::string &file : textureFiles) {
-            Image image = Image::load(path + file);
+            Image image = loadImage(path + file);
             Texture texture = renderer.createTexture(image, filtering, clamp);
             dict.textures[file] = texture;
         }
@@ -149,6 +213,12 @@ namespace Duel6 {
         return dict;
     }
 
+    Size TextureManager::discardDecodedImages() {
+        Size count = decodedImages.size();
+        decodedImages.clear();
+        return count;
+    }
+
     void TextureManager::dispose(Texture texture) {
         renderer.freeTexture(texture);
     }
@@ -34,6 +34,7 @@
 #include "Type.h"
 #include "Color.h"
 #include "Image.h"
+#include "JobSystem.h"
 #include "TextureDictionary.h"
 #include "renderer/RendererTypes.h"
 #include "aseprite/animation.h"
@@ -54,12 +55,24 @@ namespace Duel6 {
     class TextureManager {
     private:
         Renderer &renderer;
+        JobSystem &jobSystem;
+        // Images decoded ahead by decode(), each of them is taken by the first stack or dictionary using it
+        std::unordered_map<std::string, Image> decodedImages;
 
     public:
         typedef std::unordered_map<Color, Color, ColorHash> SubstitutionTable;
 
     public:
-        TextureManager(Renderer &renderer);
+        TextureManager(Renderer &renderer, JobSystem &jobSystem);
+
+        /**
+         * Decodes all images in the directories and their subdirectories in parallel on the job system. Loading
+         * the textures afterwards only creates them from the decoded images on the calling thread.
+         */
+        void decode(const std::vector<std::string> &paths);
+
+        /** Frees decoded images that no texture has taken and returns their number */
+        Size discardDecodedImages();
 
         void dispose(Texture texture);
 
@@ -81,7 +94,17 @@ namespace Duel6 {
 
         const TextureDictionary loadDict(const std::string &path, TextureFilter filtering, bool clamp);
 
+        /** Images in the directory as slices of one image, ordered by file name */
+        Image loadImageStack(const std::string &path);
+
+        Texture createTexture(const Image &image, TextureFilter filtering, bool clamp,
+                              const SubstitutionTable &substitutionTable);
+
     private:
+        Image loadImage(const std::string &path);
+
+        void findImages(const std::string &path, std::vector<std::string> &files) const;
+
         void substituteColors(Image &image, const SubstitutionTable &substitutionTable);
     };
 }
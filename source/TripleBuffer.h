@@ -0,0 +1,86 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef DUEL6_TRIPLEBUFFER_H
+#define DUEL6_TRIPLEBUFFER_H
+
+#include <atomic>
+#include "Type.h"
+
+namespace Duel6 {
+    /**
+     * Hands values over from one writing thread to one reading thread without locks. The writer fills its buffer
+     * and publishes it, the reader always gets the most recently published value. Neither thread ever waits for
+     * the other, values published while the reader is busy are skipped.
+     */
+    template<class T>
+    class TripleBuffer {
+    private:
+        static const Uint32 INDEX_MASK = 3;
+        static const Uint32 FRESH = 4;
+
+        T buffers[3];
+        Uint32 writeIndex;
+        Uint32 readIndex;
+        // Index of the buffer that is neither written nor read, FRESH is set when it holds an unread value
+        std::atomic<Uint32> middle;
+
+    public:
+        TripleBuffer()
+                : writeIndex(0), readIndex(1), middle(2) {}
+
+        TripleBuffer(const TripleBuffer &) = delete;
+
+        TripleBuffer &operator=(const TripleBuffer &) = delete;
+
+        /** Buffer owned by the writer, it keeps the contents of an older value */
+        T &getWriteBuffer() {
+            return buffers[writeIndex];
+        }
+
+        void publish() {
+            Uint32 previous = middle.exchange(writeIndex | FRESH, std::memory_order_acq_rel);
+            writeIndex = previous & INDEX_MASK;
+        }
+
+        /** Switches the reader to the most recently published value, returns false if nothing new was published */
+        bool consume() {
+            if ((middle.load(std::memory_order_relaxed) & FRESH) == 0) {
+                return false;
+            }
+            Uint32 previous = middle.exchange(readIndex, std::memory_order_acq_rel);
+            readIndex = previous & INDEX_MASK;
+            return true;
+        }
+
+        const T &getReadBuffer() const {
+            return buffers[readIndex];
+        }
+    };
+}
+
+#endif
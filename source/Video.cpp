@@ -38,19 +38,27 @@
 
 #include "renderer/gl4/GL4Renderer.h"
 
+#elif defined(D6_RENDERER_NULL)
+#include "renderer/null/NullRenderer.h"
 #endif
 
 namespace Duel6 {
-    Video::Video(const std::string &name, const std::string &icon, Console &console) {
+    Video::Video(const std::string &name, const std::string &icon, Console &console)
+            : window(nullptr), glContext(nullptr) {
+        // Set graphics mode
+        view = ViewParameters(1.0f, 40.0f, 45.0f);
+
+#if defined(D6_RENDERER_NULL)
+        // No window and no OpenGL context, only the screen geometry is needed for cameras and views
+        screen = ScreenParameters(1280, 900, 32, 24, 0, false);
+        console.printLine(Format("...Null renderer: {0}x{1}") << screen.getClientWidth() << screen.getClientHeight());
+#else
         // Get current video mode
         SDL_DisplayMode currentVideoMode;
         if (SDL_GetCurrentDisplayMode(0, &currentVideoMode)) {
             D6_THROW(VideoException, std::string("Unable to determine current video mode: ") + SDL_GetError());
         }
 
-        // Set graphics mode
-        view = ViewParameters(1.0f, 40.0f, 45.0f);
-
 #ifdef D6_DEBUG
         // Running fullscren makes switching to debugger problematic with SDL (focus is captured)
         auto requestedScreenParameters = ScreenParameters(1280, 900, 32, 24, 0, false);
@@ -67,16 +75,21 @@ namespace Duel6 {
             D6_THROW(VideoException, (const char *) glewGetErrorString(err));
         }
 
+        SDL_ShowCursor(SDL_DISABLE);
+#endif
+
         renderer = createRenderer();
 
         setMode(Mode::Orthogonal);
-
-        SDL_ShowCursor(SDL_DISABLE);
     }
 
     Video::~Video() {
-        SDL_GL_DeleteContext(glContext);
-        SDL_DestroyWindow(window);
+        if (glContext != nullptr) {
+            SDL_GL_DeleteContext(glContext);
+        }
+        if (window != nullptr) {
+            SDL_DestroyWindow(window);
+        }
     }
 
     void Video::screenUpdate(Console &console, const Font &font) {
@@ -91,7 +104,10 @@ namespace Duel6 {
     }
 
     void Video::swapBuffers() {
-        SDL_GL_SwapWindow(window);
+        renderer->flush();
+        if (window != nullptr) {
+            SDL_GL_SwapWindow(window);
+        }
         calculateFps();
     }
 
@@ -151,6 +167,10 @@ namespace Duel6 {
         majorVersion = 4;
         minorVersion = 3;
         profile = SDL_GL_CONTEXT_PROFILE_CORE;
+#else
+        majorVersion = 2;
+        minorVersion = 0;
+        profile = SDL_GL_CONTEXT_PROFILE_COMPATIBILITY;
 #endif
 
         SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, majorVersion);
@@ -185,6 +205,8 @@ namespace Duel6 {
         return std::make_unique<GLES3Renderer>();
 #elif defined(D6_RENDERER_GL4)
         return std::make_unique<GL4Renderer>();
+#elif defined(D6_RENDERER_NULL)
+        return std::make_unique<NullRenderer>();
 #endif
 
         D6_THROW(VideoException, "Invalid renderer");
@@ -214,9 +236,7 @@ namespace Duel6 {
 
     void Video::setMode(Mode mode) const {
         if (mode == Mode::Perspective) {
-            Matrix projection = Matrix::perspective(view.getFieldOfView(), screen.getAspect(), view.getNearClip(),
-                                                    view.getFarClip());
-            renderer->setProjectionMatrix(projection);
+            renderer->setProjectionMatrix(getPerspectiveMatrix());
             renderer->setViewMatrix(Matrix::IDENTITY);
             renderer->setModelMatrix(Matrix::IDENTITY);
             renderer->enableDepthTest(true);
@@ -229,6 +249,10 @@ namespace Duel6 {
         }
     }
 
+    Matrix Video::getPerspectiveMatrix() const {
+        return Matrix::perspective(view.getFieldOfView(), screen.getAspect(), view.getNearClip(), view.getFarClip());
+    }
+
     Renderer &Video::getRenderer() const {
         return *renderer;
     }
@@ -58,6 +58,10 @@ namespace Duel6 {
 
         void screenUpdate(Console &console, const Font &font);
 
+        void renderConsole(Console &console, const Font &font);
+
+        void swapBuffers();
+
         const ScreenParameters &getScreen() const {
             return screen;
         }
@@ -72,13 +76,12 @@ namespace Duel6 {
 
         void setMode(Mode mode) const;
 
+        /** Projection used in the perspective mode */
+        Matrix getPerspectiveMatrix() const;
+
         Renderer &getRenderer() const;
 
     private:
-        void renderConsole(Console &console, const Font &font);
-
-        void swapBuffers();
-
         void calculateFps();
 
         SDL_Window *createWindow(const std::string &name, const std::string &icon, const ScreenParameters &params,
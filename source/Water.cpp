@@ -40,12 +40,13 @@ namespace Duel6 {
             Texture textures;
 
         public:
-            WaterBase(Sound &sound, TextureManager &textureManager, const std::string &sample, const Color &color) {
+            WaterBase(Sound &sound, TextureManager &textureManager, const Image &image, const std::string &sample,
+                      const Color &color) {
                 splashSample = sound.loadSample(sample);
 
                 TextureManager::SubstitutionTable subst;
                 subst[Color(0, 182, 255)] = color;
-                textures = textureManager.loadStack(D6_TEXTURE_WATER_PATH, TextureFilter::Nearest, true, subst);
+                textures = textureManager.createTexture(image, TextureFilter::Nearest, true, subst);
             }
 
             void onEnter(Player &player, const Vector &location, World &world) const override {
@@ -75,8 +76,8 @@ namespace Duel6 {
 
         class BlueWater : public WaterBase {
         public:
-            BlueWater(Sound &sound, TextureManager &textureManager)
-                    : WaterBase(sound, textureManager, D6_FILE_WATER_BLUE, Color(0, 182, 255)) {}
+            BlueWater(Sound &sound, TextureManager &textureManager, const Image &image)
+                    : WaterBase(sound, textureManager, image, D6_FILE_WATER_BLUE, Color(0, 182, 255)) {}
 
             std::string getName() const override {
                 return "blue";
@@ -89,8 +90,8 @@ namespace Duel6 {
 
         class RedWater : public WaterBase {
         public:
-            RedWater(Sound &sound, TextureManager &textureManager)
-                    : WaterBase(sound, textureManager, D6_FILE_WATER_RED, Color(197, 0, 0)) {}
+            RedWater(Sound &sound, TextureManager &textureManager, const Image &image)
+                    : WaterBase(sound, textureManager, image, D6_FILE_WATER_RED, Color(197, 0, 0)) {}
 
             std::string getName() const override {
                 return "red";
@@ -103,8 +104,8 @@ namespace Duel6 {
 
         class GreenWater : public WaterBase {
         public:
-            GreenWater(Sound &sound, TextureManager &textureManager)
-                    : WaterBase(sound, textureManager, D6_FILE_WATER_GREEN, Color(0, 197, 0)) {}
+            GreenWater(Sound &sound, TextureManager &textureManager, const Image &image)
+                    : WaterBase(sound, textureManager, image, D6_FILE_WATER_GREEN, Color(0, 197, 0)) {}
 
             std::string getName() const override {
                 return "green";
@@ -122,8 +123,10 @@ namespace Duel6 {
     const Water *Water::GREEN;
 
     void Water::initialize(Sound &sound, TextureManager &textureManager) {
-        BLUE = new BlueWater(sound, textureManager);
-        RED = new RedWater(sound, textureManager);
-        GREEN = new GreenWater(sound, textureManager);
+        // All waters recolour the same splash textures
+        Image image = textureManager.loadImageStack(D6_TEXTURE_WATER_PATH);
+        BLUE = new BlueWater(sound, textureManager, image);
+        RED = new RedWater(sound, textureManager, image);
+        GREEN = new GreenWater(sound, textureManager, image);
     }
 }
@@ -59,7 +59,7 @@ namespace Duel6 {
 
             void shoot(Player &player, Orientation orientation, World &world) const override {}
 
-            SpriteList::Iterator makeSprite(SpriteList &spriteList) const override { return SpriteList::Iterator(); }
+            SpriteList::Handle makeSprite(SpriteList &spriteList) const override { return SpriteList::Handle(); }
 
             Texture getBonusTexture() const override { return Texture(); }
 
@@ -103,7 +103,7 @@ namespace Duel6 {
         impl->shoot(player, orientation, world);
     }
 
-    SpriteList::Iterator Weapon::makeSprite(SpriteList &spriteList) const {
+    SpriteList::Handle Weapon::makeSprite(SpriteList &spriteList) const {
         return impl->makeSprite(spriteList);
     }
 
@@ -151,10 +151,13 @@ namespace Duel6 {
     }
 
     const Weapon &Weapon::getRandomEnabled(const GameSettings &settings) {
-        auto &enabledWeapons = settings.getEnabledWeapons();
-        Size randomIndex = Math::random(enabledWeapons.size());
-        auto randomWeapon = enabledWeapons.cbegin();
-        std::advance(randomWeapon, randomIndex);
-        return *randomWeapon;
+        // Iterate in declaration order, the order of the hash set depends on memory addresses
+        Size randomIndex = Math::random(settings.getEnabledWeapons().size());
+        for (const Weapon &weapon : values()) {
+            if (settings.isWeaponEnabled(weapon) && randomIndex-- == 0) {
+                return weapon;
+            }
+        }
+        return values().front();
     }
 }
\ No newline at end of file
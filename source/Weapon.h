@@ -51,7 +51,7 @@ namespace Duel6 {
 
         virtual void shoot(Player &player, Orientation orientation, World &world) const = 0;
 
-        virtual SpriteList::Iterator makeSprite(SpriteList &spriteList) const = 0;
+        virtual SpriteList::Handle makeSprite(SpriteList &spriteList) const = 0;
 
         virtual Texture getBonusTexture() const = 0;
 
@@ -92,7 +92,7 @@ namespace Duel6 {
 
         void shoot(Player &player, Orientation orientation, World &world) const;
 
-        SpriteList::Iterator makeSprite(SpriteList &spriteList) const;
+        SpriteList::Handle makeSprite(SpriteList &spriteList) const;
 
         Texture getBonusTexture() const;
 
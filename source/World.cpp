@@ -31,50 +31,77 @@
 
 namespace Duel6 {
     World::World(Game &game, const std::string &levelPath, bool mirror)
-            : gameSettings(game.getSettings()), players(game.getPlayers()),
-              level(levelPath, mirror, game.getResources().getBlockMeta()),
-              levelRenderData(level, game.getAppService().getVideo().getRenderer(), gameSettings.getScreenMode(),
-                              D6_ANM_SPEED), messageQueue(D6_INFO_DURATION),
-              explosionList(game.getResources(), D6_EXPL_SPEED), fireList(game.getResources(), spriteList),
-              bonusList(game.getSettings(), game.getResources(), *this),
-              elevatorList(game.getResources().getElevatorTextures()), time(0) {
+            : World(game, game.getLevelCache().get(levelPath, mirror)) {
+    }
+
+    World::World(Game &game, std::shared_ptr<const LevelCache::Entry> cachedLevel)
+            : gameSettings(game.getSettings()), players(game.getPlayers()), level(copyLevel(cachedLevel->level)),
+              initialLevel(std::make_shared<const Level>(level)), messageQueue(D6_INFO_DURATION),
+              shotList(level.getWidth(), level.getHeight()), explosionList(D6_EXPL_SPEED),
+              fireList(game.getResources(), spriteList), bonusList(game.getSettings(), *this), time(0),
+              jobSystem(game.getAppService().getJobSystem()), updateElapsedTime(0) {
         Console &console = game.getAppService().getConsole();
         console.printLine(Format("...Width   : {0}") << level.getWidth());
         console.printLine(Format("...Height  : {0}") << level.getHeight());
-        console.printLine("...Preparing faces");
-        levelRenderData.generateFaces();
-        console.printLine(Format("...Walls   : {0}") << levelRenderData.getWalls().getFaces().size());
-        console.printLine(Format("...Sprites : {0}") << levelRenderData.getSprites().getFaces().size());
-        console.printLine(Format("...Water   : {0}") << levelRenderData.getWater().getFaces().size());
-
         console.printLine("...Level initialization");
         console.printLine("...Loading elevators");
-        elevatorList.load(levelPath, mirror);
+        elevatorList = cachedLevel->elevators;
         fireList.find(level);
         background = findBackground(game.getResources().getBcgTextures());
+        createUpdateJobs();
+    }
+
+    Level World::copyLevel(const Level &cachedLevel) {
+        Level level = cachedLevel;
+        level.chooseWater();
+        return level;
+    }
+
+    void World::createUpdateJobs() {
+        // Animations of sprites, explosions and elevators only touch their own lists. Shots add sprites,
+        // explosions and messages, shots and bonuses draw random numbers and interact with players, so they stay
+        // in the original order on a single chain.
+        JobSystem::JobId sprites = updateJobs.add([this]() {
+            spriteList.update(updateElapsedTime);
+        });
+        JobSystem::JobId explosions = updateJobs.add([this]() {
+            explosionList.update(updateElapsedTime);
+        });
+        JobSystem::JobId elevators = updateJobs.add([this]() {
+            elevatorList.update(updateElapsedTime);
+        });
+        JobSystem::JobId shots = updateJobs.add([this]() {
+            shotList.update(*this, updateElapsedTime);
+        });
+        JobSystem::JobId messages = updateJobs.add([this]() {
+            messageQueue.update(updateElapsedTime);
+        });
+        JobSystem::JobId bonuses = updateJobs.add([this]() {
+            bonusList.update(updateElapsedTime);
+        });
+
+        updateJobs.after(shots, sprites).after(shots, explosions)
+                .after(messages, shots)
+                .after(bonuses, messages).after(bonuses, elevators);
     }
 
     void World::update(Float32 elapsedTime) {
         time += elapsedTime;
 
-        spriteList.update(elapsedTime);
-        explosionList.update(elapsedTime);
-        levelRenderData.update(elapsedTime);
-        shotList.update(*this, elapsedTime);
-        elevatorList.update(elapsedTime);
-        messageQueue.update(elapsedTime);
-        bonusList.update(elapsedTime);
+        updateElapsedTime = elapsedTime;
+        jobSystem.run(updateJobs);
 
         // Add new bonuses
         Int32 mod = Int32(3.0f / elapsedTime);
         if (mod != 0 && Math::random(mod) == 0) {
             bonusList.addRandomBonus();
         }
+
+        spriteList.compact();
     }
 
     void World::raiseWater() {
         level.raiseWater();
-        levelRenderData.generateWater();
     }
 
     std::string World::findBackground(const GameResources::BackgroundList &backgrounds) {
@@ -28,14 +28,16 @@
 #ifndef DUEL6_WORLD_H
 #define DUEL6_WORLD_H
 
+#include <memory>
 #include "Level.h"
 #include "InfoMessageQueue.h"
-#include "LevelRenderData.h"
 #include "Explosion.h"
 #include "Fire.h"
 #include "ShotList.h"
 #include "BonusList.h"
 #include "ElevatorList.h"
+#include "JobSystem.h"
+#include "LevelCache.h"
 
 namespace Duel6 {
     class Game;
@@ -46,7 +48,8 @@ namespace Duel6 {
         std::vector<Player> &players;
         Level level;
         std::string background;
-        LevelRenderData levelRenderData;
+        // Copy of the level as loaded, rendering rebuilds its faces from it and the current water level
+        std::shared_ptr<const Level> initialLevel;
         InfoMessageQueue messageQueue;
         SpriteList spriteList;
         ShotList shotList;
@@ -55,6 +58,9 @@ namespace Duel6 {
         BonusList bonusList;
         ElevatorList elevatorList;
         Float32 time;
+        JobSystem &jobSystem;
+        JobSystem::Graph updateJobs;
+        Float32 updateElapsedTime;
 
     public:
         World(Game &game, const std::string &levelPath, bool mirror);
@@ -83,12 +89,8 @@ namespace Duel6 {
             return level;
         }
 
-        LevelRenderData &getLevelRenderData() {
-            return levelRenderData;
-        }
-
-        const LevelRenderData &getLevelRenderData() const {
-            return levelRenderData;
+        const std::shared_ptr<const Level> &getInitialLevel() const {
+            return initialLevel;
         }
 
         InfoMessageQueue &getMessageQueue() {
@@ -156,6 +158,12 @@ namespace Duel6 {
         }
 
     private:
+        World(Game &game, std::shared_ptr<const LevelCache::Entry> cachedLevel);
+
+        static Level copyLevel(const Level &cachedLevel);
+
+        void createUpdateJobs();
+
         std::string findBackground(const GameResources::BackgroundList &backgrounds);
     };
 }
@@ -32,9 +32,20 @@
 #include "Explosion.h"
 
 namespace Duel6 {
+    namespace {
+        // Layers of the render queue, drawn in this order
+        const Uint32 LAYER_YOU_ARE_HERE = 0;
+        const Uint32 LAYER_PLAYER_STATUS = 1;
+
+        const RenderQueue::State OPAQUE_STATE = {true, true, BlendFunc::None};
+        const RenderQueue::State OVERLAY_STATE = {false, true, BlendFunc::None};
+        const RenderQueue::State INDICATOR_STATE = {true, false, BlendFunc::SrcAlpha};
+    }
+
     WorldRenderer::WorldRenderer(Duel6::AppService &appService, const Duel6::Game &game)
-            : font(appService.getFont()), video(appService.getVideo()), game(game), renderer(video.getRenderer()),
-              target(renderer.makeTarget(video.getScreen())) {}
+            : console(appService.getConsole()), font(appService.getFont()), video(appService.getVideo()), game(game),
+              renderer(video.getRenderer()), target(renderer.makeTarget(video.getScreen())), snapshot(nullptr),
+              interpolation(1), renderedChunks(0), frameChunks(0) {}
 
     void WorldRenderer::setView(const PlayerView &view) const {
         setView(view.getX(), view.getY(), view.getWidth(), view.getHeight());
@@ -44,22 +55,22 @@ namespace Duel6 {
         renderer.setViewport(x, y, width, height);
     }
 
-    void WorldRenderer::walls(const FaceList &walls) const {
-        walls.render(game.getResources().getBlockTextures(), false);
+    void WorldRenderer::walls(const ChunkedFaceList &walls) const {
+        renderedChunks += walls.render(game.getResources().getBlockTextures(), false, frustum);
     }
 
-    void WorldRenderer::water(const FaceList &water) const {
+    void WorldRenderer::water(const ChunkedFaceList &water) const {
         renderer.enableDepthWrite(false);
         renderer.setBlendFunc(BlendFunc::SrcColor);
 
-        water.render(game.getResources().getBlockTextures(), false);
+        renderedChunks += water.render(game.getResources().getBlockTextures(), false, frustum);
 
         renderer.setBlendFunc(BlendFunc::None);
         renderer.enableDepthWrite(true);
     }
 
-    void WorldRenderer::sprites(const FaceList &sprites) const {
-        sprites.render(game.getResources().getBlockTextures(), true);
+    void WorldRenderer::sprites(const ChunkedFaceList &sprites) const {
+        renderedChunks += sprites.render(game.getResources().getBlockTextures(), true, frustum);
     }
 
     void WorldRenderer::background(Texture texture) const {
@@ -71,10 +82,10 @@ namespace Duel6 {
     void WorldRenderer::playerRankings() const {
         Float32 fontSize = 16;
         Float32 fontWidth = fontSize / 2;
-        Ranking ranking = game.getMode().getRanking(game.getPlayers());
+        const Ranking &ranking = snapshot->ranking;
         Int32 maxNameLength = ranking.getMaxLength() + 6;
 
-        const PlayerView &view = game.getPlayers().front().getView();
+        const PlayerView &view = snapshot->players.front().view;
         Int32 posX = view.getX() + view.getWidth() - fontWidth * maxNameLength - 3;
         Int32 posY = view.getY() + view.getHeight() - 20;
 
@@ -118,7 +129,7 @@ namespace Duel6 {
     void WorldRenderer::roundOverSummary() const {
         Float32 fontSize = 32;
         Float32 fontWidth = fontSize / 2;
-        Ranking ranking = game.getMode().getRanking(game.getPlayers());
+        const Ranking &ranking = snapshot->ranking;
         Int32 maxLength = ranking.getMaxLength() + 6;
         Int32 maxNameLength = maxLength + 20;
         int height = fontSize * 3; // reserve for 'SCORE'
@@ -172,11 +183,12 @@ namespace Duel6 {
 
         renderer.quadXY(Vector(x - 1, y - 1), Vector(width + 2, 18), Color::BLACK);
         font.print(x + 8, y, Color::WHITE,
-                   Format("Rounds: {0,3}|{1,3}") << game.getCurrentRound() + 1 << game.getSettings().getMaxRounds());
+                   Format("Rounds: {0,3}|{1,3}") << snapshot->currentRound + 1 << game.getSettings().getMaxRounds());
     }
 
     void WorldRenderer::fpsCounter() const {
-        std::string fpsCount = Format("FPS - {0}") << Int32(video.getFps());
+        std::string fpsCount = Format("FPS - {0}  Commands - {1}  States - {2}  Chunks - {3}")
+                << Int32(video.getFps()) << frameStats.commands << frameStats.stateChanges << frameChunks;
         Int32 width = 8 * Int32(fpsCount.size()) + 2;
 
         Int32 x = Int32(video.getScreen().getClientWidth()) - width;
@@ -187,50 +199,46 @@ namespace Duel6 {
     }
 
     void WorldRenderer::youAreHere() const {
-        Float32 remainingTime = game.getRound().getRemainingYouAreHere();
+        Float32 remainingTime = snapshot->remainingYouAreHere;
         if (remainingTime <= 0) return;
 
-        renderer.enableDepthTest(false);
 
         Float32 radius = 0.5f + 0.5f * std::abs(D6_YOU_ARE_HERE_DURATION / 2 - remainingTime);
-        for (const Player &player : game.getPlayers()) {
-            Vector playerCentre = player.getCentre();
+        for (const PlayerState &player : snapshot->players) {
+            Vector playerCentre = getPlayerCentre(player);
             playerCentre.z = 0.5;
             Vector lastPoint;
             for (Int32 u = 0; u < 37; u++) {
                 Float32 spike = (u % 2 == 0) ? 0.95f : 1.05f;
                 Vector pos = playerCentre + spike * radius * Vector::direction(u * 10);
                 if (u > 0) {
-                    renderer.line(lastPoint, pos, 3.0f, Color::YELLOW);
+                    queue.line(LAYER_YOU_ARE_HERE, OVERLAY_STATE, lastPoint, pos, 3.0f, Color::YELLOW);
                 }
                 lastPoint = pos;
             }
         }
-
-        renderer.enableDepthTest(true);
     }
 
     Float32
-    WorldRenderer::playerIndicator(const Player &player, const Indicator &indicator, const Color &color, Float32 value,
-                                   Float32 xOfs, Float32 yOfs) const {
+    WorldRenderer::playerIndicator(const PlayerState &player, const Indicator &indicator, const Color &color,
+                                   Float32 value, Float32 xOfs, Float32 yOfs) const {
         Float32 width = value * 0.98f;
         Float32 X = xOfs - 0.5f;
         Float32 Y = yOfs;
 
         Uint8 alpha = Uint8(255 * indicator.getAlpha());
 
-        renderer.enableDepthWrite(false);
-        renderer.setBlendFunc(BlendFunc::SrcAlpha);
-        renderer.quadXY(Vector(X, Y - 0.1f, 0.5f), Vector(1.0f, 0.1f), Color::BLACK.withAlpha(alpha));
-        renderer.quadXY(Vector(X + 0.01f, Y - 0.08f, 0.5f), Vector(width, 0.07f), color.withAlpha(alpha));
-        renderer.setBlendFunc(BlendFunc::None);
-        renderer.enableDepthWrite(true);
+        queue.quadXY(LAYER_PLAYER_STATUS, INDICATOR_STATE, Vector(X, Y - 0.1f, 0.5f), Vector(1.0f, 0.1f),
+                     Color::BLACK.withAlpha(alpha));
+        queue.quadXY(LAYER_PLAYER_STATUS, INDICATOR_STATE, Vector(X + 0.01f, Y - 0.08f, 0.5f), Vector(width, 0.07f),
+                     color.withAlpha(alpha));
 
         return 0.1f;
     }
 
-    void WorldRenderer::playerName(const Player &player, const Indicator &indicator, Float32 xOfs, Float32 yOfs) const {
-        const std::string &name = player.getPerson().getName();
+    void WorldRenderer::playerName(const PlayerState &player, const Indicator &indicator, Float32 xOfs,
+                                   Float32 yOfs) const {
+        const std::string &name = player.name;
 
         Float32 width = 0.15f * name.size();
         Float32 X = xOfs - width / 2;
@@ -238,19 +246,16 @@ namespace Duel6 {
 
         Uint8 alpha = Uint8(255 * indicator.getAlpha());
 
-        renderer.enableDepthWrite(false);
-        renderer.setBlendFunc(BlendFunc::SrcAlpha);
-        renderer.quadXY(Vector(X, Y, 0.5f), Vector(width, 0.3f), Color::BLUE.withAlpha(alpha));
-        renderer.setBlendFunc(BlendFunc::None);
-
-        font.print(X, Y, 0.5f, Color::YELLOW.withAlpha(alpha), name, 0.3f);
-
-        renderer.enableDepthWrite(true);
+        queue.quadXY(LAYER_PLAYER_STATUS, INDICATOR_STATE, Vector(X, Y, 0.5f), Vector(width, 0.3f),
+                     Color::BLUE.withAlpha(alpha));
+        font.print(queue, LAYER_PLAYER_STATUS, INDICATOR_STATE, X, Y, 0.5f, Color::YELLOW.withAlpha(alpha), name,
+                   0.3f);
     }
 
     void
-    WorldRenderer::bulletIndicator(const Player &player, const Indicator &indicator, Float32 xOfs, Float32 yOfs) const {
-        std::string bulletCount = Format("{0}") << player.getAmmo();
+    WorldRenderer::bulletIndicator(const PlayerState &player, const Indicator &indicator, Float32 xOfs,
+                                   Float32 yOfs) const {
+        std::string bulletCount = Format("{0}") << player.ammo;
 
         Float32 width = 0.15f * bulletCount.size();
         Float32 X = xOfs - width / 2;
@@ -258,21 +263,17 @@ namespace Duel6 {
 
         Uint8 alpha = Uint8(255 * indicator.getAlpha());
 
-        renderer.enableDepthWrite(false);
-
-        renderer.setBlendFunc(BlendFunc::SrcAlpha);
-        renderer.quadXY(Vector(X, Y, 0.5f), Vector(width, 0.3f), Color::YELLOW.withAlpha(alpha));
-        renderer.setBlendFunc(BlendFunc::None);
-
-        font.print(X, Y, 0.5f, Color::BLUE.withAlpha(alpha), bulletCount, 0.3f);
-
-        renderer.enableDepthWrite(true);
+        queue.quadXY(LAYER_PLAYER_STATUS, INDICATOR_STATE, Vector(X, Y, 0.5f), Vector(width, 0.3f),
+                     Color::YELLOW.withAlpha(alpha));
+        font.print(queue, LAYER_PLAYER_STATUS, INDICATOR_STATE, X, Y, 0.5f, Color::BLUE.withAlpha(alpha), bulletCount,
+                   0.3f);
     }
 
     void
-    WorldRenderer::bonusIndicator(const Player &player, const Indicator &indicator, Float32 xOfs, Float32 yOfs) const {
+    WorldRenderer::bonusIndicator(const PlayerState &player, const Indicator &indicator, Float32 xOfs,
+                                  Float32 yOfs) const {
         Uint8 alpha = Uint8(255 * indicator.getAlpha());
-        auto bonusType = player.getBonus();
+        auto bonusType = player.bonus;
         Material material = Material::makeColoredTexture(game.getResources().getBonusTextures(),
                                                          Color::WHITE.withAlpha(alpha));
 
@@ -280,51 +281,48 @@ namespace Duel6 {
         Float32 X = xOfs - size / 2;
         Float32 Y = yOfs;
 
-        renderer.enableDepthWrite(false);
-        renderer.setBlendFunc(BlendFunc::SrcAlpha);
-        renderer.quadXY(Vector(X, Y, 0.5f), Vector(size, size),
-                        Vector(0.3f, 0.7f, Float32(bonusType->getTextureIndex())), Vector(0.4f, -0.4f), material);
-        renderer.setBlendFunc(BlendFunc::None);
-        renderer.enableDepthWrite(true);
+        queue.quadXY(LAYER_PLAYER_STATUS, INDICATOR_STATE, Vector(X, Y, 0.5f), Vector(size, size),
+                     Vector(0.3f, 0.7f, Float32(bonusType->getTextureIndex())), Vector(0.4f, -0.4f), material);
     }
 
-    void WorldRenderer::playerStatus(const Player &player) const {
-        const auto &indicators = player.getIndicators();
+    void WorldRenderer::playerStatus(const PlayerState &player) const {
+        const auto &indicators = player.indicators;
 
-        if (player.isAlive()) {
-            Rectangle rect = player.getCollisionRect();
-            Float32 xOfs = rect.getCentre().x;
-            Float32 yOfs = rect.right.y + 0.15f;
+        if (player.alive) {
+            const Rectangle &rect = player.collisionRect;
+            Vector offset = getPlayerCentre(player) - player.centre;
+            Float32 xOfs = rect.getCentre().x + offset.x;
+            Float32 yOfs = rect.right.y + offset.y + 0.15f;
 
             const auto &reload = indicators.getReload();
             if (reload.isVisible()) {
-                Float32 interval = player.getReloadInterval();
-                Float32 value = 1.0f - std::min(interval, player.getReloadTime()) / interval;
+                Float32 interval = player.reloadInterval;
+                Float32 value = 1.0f - std::min(interval, player.reloadTime) / interval;
                 yOfs += playerIndicator(player, reload, Color::GREEN, value, xOfs, yOfs);
             }
 
             const auto &air = indicators.getAir();
             if (air.isVisible()) {
-                yOfs += playerIndicator(player, air, Color::BLUE, player.getAir() / D6_MAX_AIR, xOfs, yOfs);
+                yOfs += playerIndicator(player, air, Color::BLUE, player.air / D6_MAX_AIR, xOfs, yOfs);
             }
 
             const auto &bonus = indicators.getBonus();
             if (bonus.isVisible()) {
                 yOfs += playerIndicator(player, bonus, Color::MAGENTA,
-                                        player.getBonusRemainingTime() / player.getBonusDuration(), xOfs, yOfs);
+                                        player.bonusRemainingTime / player.bonusDuration, xOfs, yOfs);
             }
 
             const auto &health = indicators.getHealth();
             if (health.isVisible()) {
-                yOfs += playerIndicator(player, health, Color::RED, player.getLife() / D6_MAX_LIFE, xOfs, yOfs);
+                yOfs += playerIndicator(player, health, Color::RED, player.life / D6_MAX_LIFE, xOfs, yOfs);
             }
 
             const auto &name = indicators.getName();
             const auto &bullets = indicators.getBullets();
 
             Float32 space = 0.08f;
-            Float32 nameWidth = name.isVisible() ? space + player.getPerson().getName().size() * 0.15f : 0;
-            std::string bulletString = Format("{0}") << player.getAmmo();
+            Float32 nameWidth = name.isVisible() ? space + player.name.size() * 0.15f : 0;
+            std::string bulletString = Format("{0}") << player.ammo;
             Float32 bulletWidth = bullets.isVisible() ? space + bulletString.size() * 0.15f : 0;
             Float32 bonusWidth = bonus.isVisible() ? space + 0.3f : 0;
             Float32 totalWidth = nameWidth + bulletWidth + bonusWidth;
@@ -341,7 +339,7 @@ namespace Duel6 {
                 bulletIndicator(player, bullets, bulletX, yOfs);
             }
 
-            if (bonus.isVisible() && player.getBonus() != BonusType::NONE) {
+            if (bonus.isVisible() && player.bonus != BonusType::NONE) {
                 Float32 bonusX = xStart + nameWidth + bulletWidth + bonusWidth / 2;
                 bonusIndicator(player, bonus, bonusX, yOfs);
             }
@@ -354,32 +352,32 @@ namespace Duel6 {
         }
     }
 
-    void WorldRenderer::roundKills(const Player &player, Float32 xOfs, Float32 yOfs) const {
-        Float32 width = (2 * player.getRoundKills() - 1) * 0.1f;
+    void WorldRenderer::roundKills(const PlayerState &player, Float32 xOfs, Float32 yOfs) const {
+        Float32 width = (2 * player.roundKills - 1) * 0.1f;
         Float32 X = xOfs + 0.05f - width / 2;
         Float32 Y = yOfs + 0.1f;
 
-        for (Int32 i = 0; i < player.getRoundKills(); i++, X += 0.2f) {
-            renderer.point(Vector(X, Y, 0.5f), 5.0f, Color::BLUE);
+        for (Int32 i = 0; i < player.roundKills; i++, X += 0.2f) {
+            queue.point(LAYER_PLAYER_STATUS, OPAQUE_STATE, Vector(X, Y, 0.5f), 5.0f, Color::BLUE);
         }
     }
 
-    void WorldRenderer::invulRing(const Player &player) const {
-        Vector playerCentre = player.getCentre();
-        Float32 radius = player.getDimensions().length() / 2.0f;
-        Int32 p = Int32(player.getBonusRemainingTime() * 30) % 360;
+    void WorldRenderer::invulRing(Renderer &output, const PlayerState &player) const {
+        Vector playerCentre = getPlayerCentre(player);
+        Float32 radius = player.dimensions.length() / 2.0f;
+        Int32 p = Int32(player.bonusRemainingTime * 30) % 360;
 
         for (Int32 uh = p; uh < 360 + p; uh += 15) {
             Int32 u = uh % 360;
             Vector pos = playerCentre + radius * Vector::direction(u);
-            renderer.point(Vector(pos.x, pos.y, 0.5f), 2.0f, Color::RED);
+            output.point(Vector(pos.x, pos.y, 0.5f), 2.0f, Color::RED);
         }
     }
 
-    void WorldRenderer::invulRings(const std::vector<Player> &players) const {
-        for (const Player &player : players) {
-            if (player.isInvulnerable()) {
-                invulRing(player);
+    void WorldRenderer::invulRings(Renderer &output, const std::vector<PlayerState> &players) const {
+        for (const PlayerState &player : players) {
+            if (player.invulnerable) {
+                invulRing(output, player);
             }
         }
     }
@@ -401,13 +399,13 @@ namespace Duel6 {
     }
 
     void WorldRenderer::infoMessages() const {
-        const InfoMessageQueue &messageQueue = game.getRound().getWorld().getMessageQueue();
+        const InfoMessageQueue &messageQueue = snapshot->messages;
 
         if (game.getSettings().getScreenMode() == ScreenMode::FullScreen) {
-            messageQueue.renderAllMessages(renderer, game.getPlayers().front().getView(), 20, font);
+            messageQueue.renderAllMessages(renderer, snapshot->players.front().view, 20, font);
         } else {
-            for (const Player &player : game.getPlayers()) {
-                messageQueue.renderPlayerMessages(renderer, player, font);
+            for (Size i = 0; i < snapshot->players.size(); i++) {
+                messageQueue.renderPlayerMessages(renderer, i, snapshot->players[i].view, font);
             }
         }
     }
@@ -420,10 +418,17 @@ namespace Duel6 {
         });
     }
 
-    void WorldRenderer::setPlayerCamera(const Player &player) const {
-        const Camera &camera = player.getCamera();
-        Matrix viewMatrix = Matrix::lookAt(camera.getPosition(), camera.getFront(), camera.getUp());
+    void WorldRenderer::setPlayerCamera(const PlayerState &player) const {
+        const Camera &camera = player.camera;
+        const Vector &previousPosition = player.previousCameraPosition;
+        Vector position = previousPosition + (camera.getPosition() - previousPosition) * interpolation;
+        Matrix viewMatrix = Matrix::lookAt(position, camera.getFront(), camera.getUp());
         renderer.setViewMatrix(viewMatrix);
+        frustum = Frustum(video.getPerspectiveMatrix() * viewMatrix);
+    }
+
+    Vector WorldRenderer::getPlayerCentre(const PlayerState &player) const {
+        return player.previousCentre + (player.centre - player.previousCentre) * interpolation;
     }
 
     void WorldRenderer::renderStaticGeometry() const {
@@ -431,17 +436,16 @@ namespace Duel6 {
             renderer.enableWireframe(true);
         }
 
-        const World &world = game.getRound().getWorld();
-        walls(world.getLevelRenderData().getWalls());
-        sprites(world.getLevelRenderData().getSprites());
+        walls(levelRenderData->getWalls());
+        sprites(levelRenderData->getSprites());
 
         renderer.enableWireframe(false);
     }
 
     void WorldRenderer::renderBackground() const {
-        const Player &player = game.getPlayers().front();
-        setView(player.getView());
-        background(game.getResources().getBcgTextures().at(game.getRound().getWorld().getBackground()));
+        const PlayerState &player = snapshot->players.front();
+        setView(player.view);
+        background(game.getResources().getBcgTextures().at(snapshot->background));
         video.setMode(Video::Mode::Perspective);
 
         setPlayerCamera(player);
@@ -450,25 +454,35 @@ namespace Duel6 {
         video.setMode(Video::Mode::Orthogonal);
     }
 
-    void WorldRenderer::view(const Player &player) const {
-        const World &world = game.getRound().getWorld();
-        world.getElevatorList().render(renderer);
-        world.getBonusList().render(renderer);
-        world.getSpriteList().render(renderer);
-        invulRings(game.getPlayers());
-        water(world.getLevelRenderData().getWater());
+    void WorldRenderer::view() const {
+        entities(renderer);
+        water(levelRenderData->getWater());
+        overlays(renderer);
+    }
+
+    void WorldRenderer::entities(Renderer &output) const {
+        const GameResources &resources = game.getResources();
+        ElevatorList::render(output, resources.getElevatorTextures(), snapshot->elevators,
+                             snapshot->previousElevators, interpolation);
+        BonusList::render(output, resources.getBonusTextures(), snapshot->bonuses, snapshot->weapons);
+        SpriteList::render(output, snapshot->sprites, interpolation);
+        invulRings(output, snapshot->players);
+    }
+
+    void WorldRenderer::overlays(Renderer &output) const {
         youAreHere();
 
-        for (const Player &hpPlayer : game.getPlayers()) {
+        for (const PlayerState &hpPlayer : snapshot->players) {
             playerStatus(hpPlayer);
         }
+        queue.execute(output);
         //shotCollisionBox(world.getShotList());
 
-        world.getExplosionList().render(renderer);
+        ExplosionList::render(output, game.getResources().getExplosionTextures(), snapshot->explosions);
     }
 
     Color WorldRenderer::getGameOverOverlay() const {
-        Float32 overlay = game.getRound().getRemainingGameOverWait() / D6_GAME_OVER_WAIT;
+        Float32 overlay = snapshot->remainingGameOverWait / D6_GAME_OVER_WAIT;
         return Color(128, 0, 0, Uint8(200 - 200 * overlay));
     }
 
@@ -484,9 +498,9 @@ namespace Duel6 {
     }
 
     void WorldRenderer::fullScreen() const {
-        const Player &player = game.getPlayers().front();
-        Float32 remainingTime = game.getRound().getRemainingYouAreHere();
-        setView(player.getView());
+        const PlayerState &player = snapshot->players.front();
+        Float32 remainingTime = snapshot->remainingYouAreHere;
+        setView(player.view);
 
         renderer.clearBuffers(); // attempt to resolve rendering issues in Alcatraz
         Color fadeColor = remainingTime > 0 ? getRoundStartFadeColor(remainingTime) : Color::WHITE;
@@ -495,9 +509,9 @@ namespace Duel6 {
         renderer.enableDepthTest(true);
         video.setMode(Video::Mode::Perspective);
         setPlayerCamera(player);
-        view(player);
+        view();
 
-        if (game.getRound().hasWinner()) {
+        if (snapshot->winner) {
             Color overlayColor = getGameOverOverlay();
             screenCurtain(overlayColor);
         }
@@ -506,19 +520,27 @@ namespace Duel6 {
     void WorldRenderer::splitScreen() const {
         renderer.clearBuffers();
 
-        for (const Player &player : game.getPlayers()) {
+        // Entities look the same in every view, they are drawn once into draw lists replayed by each view
+        entityList.clear();
+        entities(entityList);
+        overlayList.clear();
+        overlays(overlayList);
+
+        for (const PlayerState &player : snapshot->players) {
             video.setMode(Video::Mode::Orthogonal);
-            splitBox(player.getView());
+            splitBox(player.view);
 
-            setView(player.getView());
-            background(game.getResources().getBcgTextures().at(game.getRound().getWorld().getBackground()));
+            setView(player.view);
+            background(game.getResources().getBcgTextures().at(snapshot->background));
 
             video.setMode(Video::Mode::Perspective);
             setPlayerCamera(player);
             renderStaticGeometry();
-            view(player);
+            entityList.replay(renderer);
+            water(levelRenderData->getWater());
+            overlayList.replay(renderer);
 
-            if (!player.isAlive()) {
+            if (!player.alive) {
                 screenCurtain(Color(255, 0, 0, 128));
             }
         }
@@ -530,8 +552,51 @@ namespace Duel6 {
         });
     }
 
-    void WorldRenderer::render() const {
+    void WorldRenderer::updateLevel() const {
+        if (snapshot->level != renderedLevel) {
+            renderedLevel = snapshot->level;
+            LevelCache &levelCache = game.getLevelCache();
+            levelCache.enableRenderData(renderer, game.getSettings().getScreenMode(), D6_ANM_SPEED);
+            std::unique_ptr<LevelCache::RenderData> prepared = levelCache.takeRenderData(renderedLevel->getPath(),
+                                                                                         renderedLevel->isMirror());
+            if (prepared != nullptr) {
+                console.printLine("...Using prefetched faces");
+                level = std::move(prepared->level);
+                level->setWaterBlock(renderedLevel->getWaterBlock());
+                levelRenderData = std::move(prepared->renderData);
+            } else {
+                level = std::make_unique<Level>(*renderedLevel);
+                levelRenderData = std::make_unique<LevelRenderData>(*level, renderer,
+                                                                    game.getSettings().getScreenMode(), D6_ANM_SPEED);
+                console.printLine("...Preparing faces");
+                levelRenderData->generateFaces();
+            }
+            console.printLine(Format("...Walls   : {0} (merged from {1})") << levelRenderData->getWalls().getFaceCount()
+                                                                             << levelRenderData->getUnmergedWallFaces());
+            console.printLine(Format("...Sprites : {0}") << levelRenderData->getSprites().getFaceCount());
+            console.printLine(Format("...Water   : {0}") << levelRenderData->getWater().getFaceCount());
+            console.printLine(Format("...Chunks  : {0}") << levelRenderData->getWalls().getChunkCount());
+            prerender();
+        }
+
+        if (level->getWaterLevel() < snapshot->waterLevel) {
+            Level::CellList changedCells;
+            while (level->getWaterLevel() < snapshot->waterLevel) {
+                level->raiseWater(changedCells);
+            }
+            levelRenderData->updateWater(changedCells);
+        }
+
+        levelRenderData->update(snapshot->worldTime);
+    }
+
+    void WorldRenderer::render(const GameSnapshot &snapshot, Float32 interpolation) const {
+        this->snapshot = &snapshot;
+        this->interpolation = interpolation;
+        updateLevel();
+
         const GameSettings &settings = game.getSettings();
+        renderer.setGlobalTime(snapshot.worldTime);
 
         if (settings.getScreenMode() == ScreenMode::FullScreen) {
             fullScreen();
@@ -556,16 +621,21 @@ namespace Duel6 {
             roundsPlayed();
         }
 
-        if (game.isDisplayingScoreTab()) {
+        if (snapshot.displayScoreTab) {
             roundOverSummary();
         }
 
-        if (game.getRound().hasWinner()) {
-            if (game.isOver()) {
+        if (snapshot.winner) {
+            if (snapshot.gameOver) {
                 gameOverSummary();
             } else {
                 roundOverSummary();
             }
         }
+
+        frameStats = queue.getStats();
+        queue.resetStats();
+        frameChunks = renderedChunks;
+        renderedChunks = 0;
     }
 }
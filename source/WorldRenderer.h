@@ -28,6 +28,7 @@
 #ifndef DUEL6_RENDERER_H
 #define DUEL6_RENDERER_H
 
+#include <memory>
 #include <vector>
 #include "Type.h"
 #include "Player.h"
@@ -35,44 +36,77 @@
 #include "Video.h"
 #include "GameSettings.h"
 #include "GameResources.h"
-#include "FaceList.h"
+#include "GameSnapshot.h"
+#include "LevelRenderData.h"
+#include "math/Frustum.h"
 #include "ShotList.h"
 #include "Ranking.h"
 #include "renderer/RendererTarget.h"
+#include "renderer/DrawList.h"
+#include "renderer/RenderQueue.h"
 
 namespace Duel6 {
     class Game;
 
+    /**
+     * Draws game snapshots. The renderer keeps its own copy of the level, it is replaced when a snapshot of
+     * a new round arrives and flooded up to the water level of the snapshot.
+     */
     class WorldRenderer {
     private:
+        typedef GameSnapshot::PlayerState PlayerState;
+
+        Console &console;
         const Font &font;
         const Video &video;
         const Game &game;
         Renderer &renderer;
         std::unique_ptr<RendererTarget> target;
+        mutable const GameSnapshot *snapshot;
+        mutable Float32 interpolation;
+        mutable std::shared_ptr<const Level> renderedLevel;
+        mutable std::unique_ptr<Level> level;
+        mutable std::unique_ptr<LevelRenderData> levelRenderData;
+        mutable RenderQueue queue;
+        mutable DrawList entityList;
+        mutable DrawList overlayList;
+        mutable RenderQueue::Stats frameStats;
+        mutable Frustum frustum;
+        mutable Size renderedChunks;
+        mutable Size frameChunks;
 
     public:
         WorldRenderer(AppService &appService, const Game &game);
 
-        void render() const;
-        void prerender() const;
+        /** Positions are interpolated between the previous and current tick of the snapshot */
+        void render(const GameSnapshot &snapshot, Float32 interpolation) const;
 
     private:
+        void prerender() const;
+
+        void updateLevel() const;
+
         void setView(const PlayerView &view) const;
 
         void setView(int x, int y, int width, int height) const;
 
-        void view(const Player &player) const;
+        void view() const;
+
+        /** Elevators, bonuses, sprites and invulnerability rings, drawn before water */
+        void entities(Renderer &output) const;
+
+        /** Player status, round start markers and explosions, drawn after water */
+        void overlays(Renderer &output) const;
 
         void fullScreen() const;
 
         void splitScreen() const;
 
-        void walls(const FaceList &walls) const;
+        void walls(const ChunkedFaceList &walls) const;
 
-        void water(const FaceList &water) const;
+        void water(const ChunkedFaceList &water) const;
 
-        void sprites(const FaceList &sprites) const;
+        void sprites(const ChunkedFaceList &sprites) const;
 
         void background(Texture texture) const;
 
@@ -96,22 +130,22 @@ namespace Duel6 {
 
         void youAreHere() const;
 
-        void roundKills(const Player &player, Float32 xOfs, Float32 yOfs) const;
+        void roundKills(const PlayerState &player, Float32 xOfs, Float32 yOfs) const;
 
-        void playerStatus(const Player &player) const;
+        void playerStatus(const PlayerState &player) const;
 
-        Float32 playerIndicator(const Player &player, const Indicator &indicator, const Color &color, Float32 value,
-                                Float32 xOfs, Float32 yOfs) const;
+        Float32 playerIndicator(const PlayerState &player, const Indicator &indicator, const Color &color,
+                                Float32 value, Float32 xOfs, Float32 yOfs) const;
 
-        void playerName(const Player &player, const Indicator &indicator, Float32 xOfs, Float32 yOfs) const;
+        void playerName(const PlayerState &player, const Indicator &indicator, Float32 xOfs, Float32 yOfs) const;
 
-        void bulletIndicator(const Player &player, const Indicator &indicator, Float32 xOfs, Float32 yOfs) const;
+        void bulletIndicator(const PlayerState &player, const Indicator &indicator, Float32 xOfs, Float32 yOfs) const;
 
-        void bonusIndicator(const Player &player, const Indicator &indicator, Float32 xOfs, Float32 yOfs) const;
+        void bonusIndicator(const PlayerState &player, const Indicator &indicator, Float32 xOfs, Float32 yOfs) const;
 
-        void invulRings(const std::vector<Player> &players) const;
+        void invulRings(Renderer &output, const std::vector<PlayerState> &players) const;
 
-        void invulRing(const Player &player) const;
+        void invulRing(Renderer &output, const PlayerState &player) const;
 
         void splitBox(const PlayerView &view) const;
 
@@ -125,7 +159,9 @@ namespace Duel6 {
 
         void shotCollisionBox(const ShotList &shotList) const;
 
-        void setPlayerCamera(const Player &player) const;
+        void setPlayerCamera(const PlayerState &player) const;
+
+        Vector getPlayerCentre(const PlayerState &player) const;
 
         void renderStaticGeometry() const;
     };
@@ -0,0 +1,118 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef DUEL6_COLLISION_SPATIALGRID_H
+#define DUEL6_COLLISION_SPATIALGRID_H
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "../Type.h"
+#include "../Rectangle.h"
+
+namespace Duel6 {
+    /** Inclusive range of grid cells covered by a rectangle */
+    struct SpatialGridCells {
+        Int32 left = 0;
+        Int32 bottom = 0;
+        Int32 right = -1;
+        Int32 top = -1;
+    };
+
+    /**
+     * Uniform grid over the level used as a collision broadphase. Items are registered in every cell their
+     * bounding rectangle touches, a query returns the items registered in the cells of the queried rectangle.
+     * Rectangles outside of the level are clamped to the border cells.
+     */
+    template<class T>
+    class SpatialGrid {
+    private:
+        Float32 cellSize;
+        Int32 width;
+        Int32 height;
+        std::vector<std::vector<T *>> cells;
+
+    public:
+        SpatialGrid(Int32 levelWidth, Int32 levelHeight, Float32 cellSize)
+                : cellSize(cellSize), width(std::max(1, Int32(std::ceil(levelWidth / cellSize)))),
+                  height(std::max(1, Int32(std::ceil(levelHeight / cellSize)))), cells(width * height) {}
+
+        SpatialGridCells getCells(const Rectangle &rect) const {
+            SpatialGridCells range;
+            range.left = clamp(rect.left.x, width);
+            range.right = clamp(rect.right.x, width);
+            range.bottom = clamp(rect.left.y, height);
+            range.top = clamp(rect.right.y, height);
+            return range;
+        }
+
+        void insert(T *item, const SpatialGridCells &range) {
+            for (Int32 y = range.bottom; y <= range.top; y++) {
+                for (Int32 x = range.left; x <= range.right; x++) {
+                    cells[y * width + x].push_back(item);
+                }
+            }
+        }
+
+        void remove(T *item, const SpatialGridCells &range) {
+            for (Int32 y = range.bottom; y <= range.top; y++) {
+                for (Int32 x = range.left; x <= range.right; x++) {
+                    std::vector<T *> &cell = cells[y * width + x];
+                    auto position = std::find(cell.begin(), cell.end(), item);
+                    if (position != cell.end()) {
+                        *position = cell.back();
+                        cell.pop_back();
+                    }
+                }
+            }
+        }
+
+        void clear() {
+            for (std::vector<T *> &cell : cells) {
+                cell.clear();
+            }
+        }
+
+        /** Appends items registered in the given cells, an item covering more cells is appended more than once */
+        void query(const SpatialGridCells &range, std::vector<T *> &items) const {
+            for (Int32 y = range.bottom; y <= range.top; y++) {
+                for (Int32 x = range.left; x <= range.right; x++) {
+                    const std::vector<T *> &cell = cells[y * width + x];
+                    items.insert(items.end(), cell.begin(), cell.end());
+                }
+            }
+        }
+
+    private:
+        Int32 clamp(Float32 coordinate, Int32 size) const {
+            Int32 cell = Int32(std::floor(coordinate / cellSize));
+            return std::min(std::max(cell, 0), size - 1);
+        }
+    };
+}
+
+#endif
@@ -46,7 +46,6 @@ void CollidingEntity::collideWithElevators(ElevatorList & elevators, Float32 ela
 }
 
 void CollidingEntity::collideWithLevel(const Level & level, Float32 elapsedTime, Float32 speed) {
-    static bool bleft = false, bright = false, bup = false, bdown = false;
     {
         Float32 delta = 0.8f * VERTICAL_DELTA;
         Float32 down = position.y - FLOOR_DISTANCE_THRESHOLD;
@@ -100,7 +99,7 @@ void CollidingEntity::collideWithLevel(const Level & level, Float32 elapsedTime,
         externalForcesSpeed.x = std::copysign(0.5f, externalForcesSpeed.x) / speed;
     }
     Vector totalSpeed = velocity + externalForcesSpeed;
-    bleft = false, bright = false, bup = false, bdown = false;
+    bool bleft = false, bright = false, bup = false, bdown = false;
 
     //collision detection here we go
 
@@ -30,6 +30,7 @@ Projekt: Konzole
 Popis: Hlavni funkce
 */
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include "ConsoleException.h"
@@ -72,6 +73,11 @@ namespace Duel6 {
     }
 
     Console &Console::print(const std::string &str) {
+        std::lock_guard<std::mutex> lock(textMutex);
+        if (hasFlag(StdOutFlag)) {
+            fputs(str.c_str(), stdout);
+        }
+
         for (size_t pos = 0; pos < str.length(); ++pos) {
             char tx = str[pos];
 
@@ -102,9 +108,7 @@ namespace Duel6 {
     }
 
     Console &Console::printLine(const std::string &str) {
-        print(str);
-        print("\n");
-        return *this;
+        return print(str + "\n");
     }
 
     void Console::verifyRegistration(const std::string &proc, const std::string &name, bool isNull) {
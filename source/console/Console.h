@@ -39,6 +39,7 @@ Potrebuje: Knihovnu mylib
 #include <list>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <SDL2/SDL_keyboard.h>
 
 #include "../Type.h"
@@ -79,7 +80,8 @@ namespace Duel6 {
         enum Flags {
             NonFlag = 0x00,
             RegInfoFlag = 0x01,
-            ExpandFlag = 0x02
+            ExpandFlag = 0x02,
+            StdOutFlag = 0x04
         };
 
     public:
@@ -267,6 +269,7 @@ namespace Duel6 {
     private:
         bool visible;                      // Je konzole viditelna/aktivni?
         std::vector<Uint8> text;                      // Textovy buffer
+        std::mutex textMutex;                         // Games print from the simulation and render threads
         int width;                        // Sirka konzoly ve znacich
         unsigned long bufpos;                       // Pozice v bufferu kam se tiskne
         bool buffull;                      // Uz byl buffer prerotovan? Je plny?
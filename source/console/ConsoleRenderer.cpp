@@ -142,6 +142,8 @@ namespace Duel6 {
             return;
         }
 
+        std::lock_guard<std::mutex> lock(textMutex);
+
         // Reformat console if the width has changed
         if (csX / font.getCharWidth() != width) {
             width = csX / font.getCharWidth();
@@ -0,0 +1,236 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "../Format.h"
+#include "JsonDocument.h"
+
+namespace Duel6 {
+    namespace Json {
+        Document::Document()
+                : root(0) {
+            addNode(NodeType::Null, 0, 0);
+        }
+
+        Node Document::getRoot() const {
+            return Node(*this, root);
+        }
+
+        Uint32 Document::addNode(NodeType type, Size first, Size length) {
+            nodes.push_back({type, Uint32(first), Uint32(length)});
+            return Uint32(nodes.size() - 1);
+        }
+
+        Uint32 Document::internKey(const std::string &key) {
+            auto keyId = keyIds.find(key);
+            if (keyId != keyIds.end()) {
+                return keyId->second;
+            }
+
+            keys.push_back(key);
+            keyIds.insert(std::make_pair(key, Uint32(keys.size() - 1)));
+            return Uint32(keys.size() - 1);
+        }
+
+        const Document::Member *Document::findMember(const NodeData &object, const std::string &propertyName) const {
+            auto keyId = keyIds.find(propertyName);
+            if (keyId == keyIds.end()) {
+                return nullptr;
+            }
+
+            for (Uint32 i = object.first; i < object.first + object.length; i++) {
+                if (members[i].key == keyId->second) {
+                    return &members[i];
+                }
+            }
+            return nullptr;
+        }
+
+        const Document::NodeData &Node::getData() const {
+            return document->nodes[index];
+        }
+
+        std::string Node::getTypeError(const char *expected) const {
+            static const char *typeNames[] = {"Null", "Object", "Array", "Number", "String", "Boolean"};
+            return std::string("Invalid JSON value type - expected: ") + expected + ", got: " +
+                   typeNames[Size(getType())];
+        }
+
+        Value::Type Node::getType() const {
+            if (element != NO_ELEMENT) {
+                return Value::Type::Number;
+            }
+
+            switch (getData().type) {
+                case Document::NodeType::Null:
+                    return Value::Type::Null;
+                case Document::NodeType::Boolean:
+                    return Value::Type::Boolean;
+                case Document::NodeType::Number:
+                    return Value::Type::Number;
+                case Document::NodeType::String:
+                    return Value::Type::String;
+                case Document::NodeType::Object:
+                    return Value::Type::Object;
+                default:
+                    return Value::Type::Array;
+            }
+        }
+
+        bool Node::has(const std::string &propertyName) const {
+            if (getType() != Value::Type::Object) {
+                D6_THROW(JsonException, getTypeError("Object"));
+            }
+            return document->findMember(getData(), propertyName) != nullptr;
+        }
+
+        Node Node::get(const std::string &propertyName) const {
+            if (getType() != Value::Type::Object) {
+                D6_THROW(JsonException, getTypeError("Object"));
+            }
+
+            const Document::Member *member = document->findMember(getData(), propertyName);
+            if (member == nullptr) {
+                D6_THROW(JsonException, std::string("Property ") + propertyName + " not found");
+            }
+            return Node(*document, member->node);
+        }
+
+        std::vector<std::string> Node::getPropertyNames() const {
+            if (getType() != Value::Type::Object) {
+                D6_THROW(JsonException, getTypeError("Object"));
+            }
+
+            const Document::NodeData &data = getData();
+            std::vector<std::string> propNames;
+            for (Uint32 i = data.first; i < data.first + data.length; i++) {
+                propNames.push_back(document->keys[document->members[i].key]);
+            }
+            return propNames;
+        }
+
+        Node Node::get(Size index) const {
+            if (getType() != Value::Type::Array) {
+                D6_THROW(JsonException, getTypeError("Array"));
+            }
+
+            const Document::NodeData &data = getData();
+            if (index >= data.length) {
+                D6_THROW(JsonException, Format("Array index {0} out of range {1}") << index << data.length);
+            }
+            if (data.type == Document::NodeType::Array) {
+                return Node(*document, document->items[data.first + index]);
+            }
+            return Node(*document, this->index, Uint32(index));
+        }
+
+        Size Node::getLength() const {
+            if (getType() != Value::Type::Array) {
+                D6_THROW(JsonException, getTypeError("Array"));
+            }
+            return getData().length;
+        }
+
+        std::string Node::asString() const {
+            if (getType() != Value::Type::String) {
+                D6_THROW(JsonException, getTypeError("String"));
+            }
+
+            const Document::NodeData &data = getData();
+            return document->characters.substr(data.first, data.length);
+        }
+
+        Int32 Node::asInt() const {
+            const Document::NodeData &data = getData();
+            if (element != NO_ELEMENT && data.type == Document::NodeType::IntArray) {
+                return document->integers[data.first + element];
+            }
+            return (Int32) asDouble();
+        }
+
+        Float64 Node::asDouble() const {
+            if (getType() != Value::Type::Number) {
+                D6_THROW(JsonException, getTypeError("Number"));
+            }
+
+            const Document::NodeData &data = getData();
+            if (element == NO_ELEMENT) {
+                return document->numbers[data.first];
+            } else if (data.type == Document::NodeType::IntArray) {
+                return document->integers[data.first + element];
+            }
+            return document->numbers[data.first + element];
+        }
+
+        bool Node::asBoolean() const {
+            if (getType() != Value::Type::Boolean) {
+                D6_THROW(JsonException, getTypeError("Boolean"));
+            }
+            return getData().first != 0;
+        }
+
+        Span<Int32> Node::asIntArray() const {
+            if (getType() != Value::Type::Array) {
+                D6_THROW(JsonException, getTypeError("Array"));
+            }
+
+            const Document::NodeData &data = getData();
+            if (data.type != Document::NodeType::IntArray) {
+                D6_THROW(JsonException, "Invalid JSON array - expected only integers");
+            }
+            return Span<Int32>(document->integers.data() + data.first, data.length);
+        }
+
+        Value Node::toValue() const {
+            switch (getType()) {
+                case Value::Type::Boolean:
+                    return Value::makeBoolean(asBoolean());
+                case Value::Type::Number:
+                    return Value::makeNumber(asDouble());
+                case Value::Type::String:
+                    return Value::makeString(asString());
+                case Value::Type::Array: {
+                    Value value = Value::makeArray();
+                    for (Size i = 0; i < getLength(); i++) {
+                        value.add(get(i).toValue());
+                    }
+                    return value;
+                }
+                case Value::Type::Object: {
+                    Value value = Value::makeObject();
+                    const Document::NodeData &data = getData();
+                    for (Uint32 i = data.first; i < data.first + data.length; i++) {
+                        const Document::Member &member = document->members[i];
+                        value.set(document->keys[member.key], Node(*document, member.node).toValue());
+                    }
+                    return value;
+                }
+                default:
+                    return Value::makeNull();
+            }
+        }
+    }
+}
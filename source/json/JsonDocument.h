@@ -0,0 +1,180 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef DUEL6_JSON_JSONDOCUMENT_H
+#define DUEL6_JSON_JSONDOCUMENT_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../Type.h"
+#include "JsonValue.h"
+
+namespace Duel6 {
+    namespace Json {
+        /** Contiguous read-only sequence of values stored in a document */
+        template<class T>
+        class Span {
+        private:
+            const T *first;
+            Size length;
+
+        public:
+            Span()
+                    : first(nullptr), length(0) {}
+
+            Span(const T *first, Size length)
+                    : first(first), length(length) {}
+
+            const T *begin() const {
+                return first;
+            }
+
+            const T *end() const {
+                return first + length;
+            }
+
+            Size size() const {
+                return length;
+            }
+
+            bool empty() const {
+                return length == 0;
+            }
+
+            const T &operator[](Size index) const {
+                return first[index];
+            }
+        };
+
+        class Node;
+
+        /**
+         * Parsed JSON file with all values stored in a few arrays owned by the document.
+         * Object keys are interned and arrays of numbers are stored as flat spans of integers or doubles.
+         */
+        class Document {
+        private:
+            friend class Node;
+            friend class Parser;
+
+            enum class NodeType : Uint8 {
+                Null,
+                Boolean,
+                Number,
+                String,
+                Array,
+                IntArray,
+                NumberArray,
+                Object
+            };
+
+            // Meaning of first and length depends on the type, e.g. a range of items, members or string characters
+            struct NodeData {
+                NodeType type;
+                Uint32 first;
+                Uint32 length;
+            };
+
+            struct Member {
+                Uint32 key;
+                Uint32 node;
+            };
+
+        private:
+            std::vector<NodeData> nodes;
+            std::vector<Uint32> items;
+            std::vector<Member> members;
+            std::vector<Float64> numbers;
+            std::vector<Int32> integers;
+            std::string characters;
+            std::vector<std::string> keys;
+            std::unordered_map<std::string, Uint32> keyIds;
+            Uint32 root;
+
+        public:
+            Document();
+
+            Node getRoot() const;
+
+        private:
+            Uint32 addNode(NodeType type, Size first, Size length);
+
+            Uint32 internKey(const std::string &key);
+
+            const Member *findMember(const NodeData &object, const std::string &propertyName) const;
+        };
+
+        /** Read-only view of a value in a document, valid as long as the document exists */
+        class Node {
+        private:
+            static const Uint32 NO_ELEMENT = 0xffffffff;
+
+        private:
+            const Document *document;
+            Uint32 index;
+            Uint32 element; // Item of a flat number array
+
+        public:
+            Node(const Document &document, Uint32 index, Uint32 element = NO_ELEMENT)
+                    : document(&document), index(index), element(element) {}
+
+            Value::Type getType() const;
+
+            bool has(const std::string &propertyName) const;
+
+            Node get(const std::string &propertyName) const;
+
+            std::vector<std::string> getPropertyNames() const;
+
+            Node get(Size index) const;
+
+            Size getLength() const;
+
+            std::string asString() const;
+
+            Int32 asInt() const;
+
+            Float64 asDouble() const;
+
+            bool asBoolean() const;
+
+            /** Items of an array which contains only integers */
+            Span<Int32> asIntArray() const;
+
+            /** Copies the value into a mutable tree */
+            Value toValue() const;
+
+        private:
+            const Document::NodeData &getData() const;
+
+            std::string getTypeError(const char *expected) const;
+        };
+    }
+}
+
+#endif
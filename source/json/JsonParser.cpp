@@ -25,202 +25,324 @@
 * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <climits>
+#include <cstdlib>
+#include "../File.h"
 #include "JsonParser.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define D6_JSON_SSE2
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
 namespace Duel6 {
     namespace Json {
         namespace {
-            std::unordered_set<Uint8> stringSentinel = {'"'};
-            std::unordered_set<Uint8> numberChars = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '0', '.', '-',
-                                                     'e'};
+            bool isWhitespace(char c) {
+                return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+            }
+
+            bool isNumberStart(char c) {
+                return (c >= '0' && c <= '9') || c == '-' || c == '.';
+            }
+
+            bool isNumberCharacter(char c) {
+                return (c >= '0' && c <= '9') || c == '.' || c == '-' || c == '+' || c == 'e' || c == 'E';
+            }
+
+#ifdef D6_JSON_SSE2
+            Uint32 countTrailingZeros(Uint32 mask) {
+#ifdef _MSC_VER
+                unsigned long index;
+                _BitScanForward(&index, mask);
+                return Uint32(index);
+#else
+                return Uint32(__builtin_ctz(mask));
+#endif
+            }
+#endif
+
+            const char *skipWhitespace(const char *pos) {
+                // Most runs are a single space between tokens, longer indentation is skipped 16 bytes at a time
+                while (isWhitespace(*pos)) {
+#ifdef D6_JSON_SSE2
+                    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+                    __m128i whitespace = _mm_or_si128(
+                            _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n'))),
+                            _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r')), _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t'))));
+                    Uint32 mask = ~Uint32(_mm_movemask_epi8(whitespace)) & 0xffff;
+                    if (mask != 0) {
+                        return pos + countTrailingZeros(mask);
+                    }
+                    pos += 16;
+#else
+                    pos++;
+#endif
+                }
+                return pos;
+            }
+
+            // Returns the closing quote or a zero byte, which is either part of the string or the end of the text
+            const char *findStringEnd(const char *pos) {
+#ifdef D6_JSON_SSE2
+                while (true) {
+                    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+                    __m128i found = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('"')),
+                                                 _mm_cmpeq_epi8(chunk, _mm_setzero_si128()));
+                    Uint32 mask = Uint32(_mm_movemask_epi8(found));
+                    if (mask != 0) {
+                        return pos + countTrailingZeros(mask);
+                    }
+                    pos += 16;
+                }
+#else
+                while (*pos != '"' && *pos != '\0') {
+                    pos++;
+                }
+                return pos;
+#endif
+            }
         }
 
-        Value Parser::parse(const std::string &fileName) const {
-            File file(fileName, File::Mode::Binary, File::Access::Read);
-            return parseValue(file);
+        Value Parser::parse(const std::string &fileName) {
+            return parseDocument(fileName).getRoot().toValue();
         }
 
-        Value Parser::parseValue(File &file) const {
-            Uint8 byte = peekNextCharacter(file);
-            Value::Type type = determineValueType(byte);
+        Document Parser::parseDocument(const std::string &fileName) {
+            std::vector<char> text = load(fileName);
+            return parseDocument(text.data(), text.data() + text.size() - PADDING);
+        }
+
+        Document Parser::parseDocument(const char *begin, const char *end) {
+            Document document;
+            const char *pos = begin;
+            itemStack.clear();
+            memberStack.clear();
+            numberStack.clear();
+            document.root = parseValue(document, pos, end);
+            return document;
+        }
 
-            switch (type) {
-                case Value::Type::Null:
-                    return parseNull(file);
-                case Value::Type::Object:
-                    return parseObject(file);
-                case Value::Type::Array:
-                    return parseArray(file);
-                case Value::Type::Number:
-                    return parseNumber(file);
-                case Value::Type::String:
-                    return parseString(file);
-                case Value::Type::Boolean:
-                    return parseBoolean(file);
+        std::vector<char> Parser::load(const std::string &fileName) {
+            Size length = File::getSize(fileName);
+            std::vector<char> text(length + PADDING, '\0');
+            File file(fileName, File::Mode::Binary, File::Access::Read);
+            file.read(text.data(), 1, length);
+            return text;
+        }
+
+        Uint32 Parser::parseValue(Document &document, const char *&pos, const char *end) {
+            char c = peekNextCharacter(pos, end);
+
+            if (c == '{') {
+                return parseObject(document, pos, end);
+            } else if (c == '[') {
+                return parseArray(document, pos, end);
+            } else if (c == '"') {
+                return parseString(document, pos, end);
+            } else if (c == 't' || c == 'f') {
+                return parseBoolean(document, pos, end);
+            } else if (isNumberStart(c)) {
+                return parseNumber(document, pos, end);
+            } else if (c == 'n') {
+                return parseNull(document, pos, end);
             }
 
-            D6_THROW(JsonException, "Unhandled type: " + std::to_string((Int32) type));
+            D6_THROW(JsonException, std::string("Invalid value type found, starting with: ") + c);
         }
 
-        Value Parser::parseNull(File &file) const {
-            readExpected(file, "null");
-            return Value::makeNull();
+        Uint32 Parser::parseNull(Document &document, const char *&pos, const char *end) {
+            readExpected(pos, end, "null");
+            return document.addNode(Document::NodeType::Null, 0, 0);
         }
 
-        Value Parser::parseObject(File &file) const {
-            Value value = Value::makeObject();
+        Uint32 Parser::parseObject(Document &document, const char *&pos, const char *end) {
+            Size memberBase = memberStack.size();
 
-            readExpected(file, '{');
-            Uint8 next = peekNextCharacter(file);
+            readExpected(pos, end, '{');
+            char next = peekNextCharacter(pos, end);
             if (next == '}') {
-                readExpected(file, '}');
+                pos++;
             } else {
                 do {
-                    readWhitespaceAndExpected(file, '"');
-                    std::string propName = readUntil(file, stringSentinel);
-                    readExpected(file, '"');
-                    readWhitespaceAndExpected(file, ':');
-                    value.set(propName, parseValue(file));
-
-                    next = peekNextCharacter(file);
+                    peekNextCharacter(pos, end);
+                    const char *name = readString(pos, end);
+                    Uint32 key = document.internKey(std::string(name, pos - 1));
+                    peekNextCharacter(pos, end);
+                    readExpected(pos, end, ':');
+                    Uint32 node = parseValue(document, pos, end);
+
+                    // The last occurrence of a repeated property wins
+                    auto member = std::find_if(memberStack.begin() + memberBase, memberStack.end(),
+                                               [key](const Document::Member &member) {
+                                                   return member.key == key;
+                                               });
+                    if (member != memberStack.end()) {
+                        member->node = node;
+                    } else {
+                        memberStack.push_back({key, node});
+                    }
 
+                    next = peekNextCharacter(pos, end);
                     if (next != ',' && next != '}') {
-                        D6_THROW(JsonException,
-                                 std::string("Expected next property or end of object, got: ") + (char) next);
+                        D6_THROW(JsonException, std::string("Expected next property or end of object, got: ") + next);
                     }
-
-                    readExpected(file, (char) next);
+                    pos++;
                 } while (next == ',');
             }
 
-            return value;
+            Size first = document.members.size();
+            document.members.insert(document.members.end(), memberStack.begin() + memberBase, memberStack.end());
+            memberStack.resize(memberBase);
+            return document.addNode(Document::NodeType::Object, first, document.members.size() - first);
         }
 
-        Value Parser::parseArray(File &file) const {
-            Value value = Value::makeArray();
+        Uint32 Parser::parseArray(Document &document, const char *&pos, const char *end) {
+            Size itemBase = itemStack.size();
+            Size numberBase = numberStack.size();
+            bool onlyNumbers = true;
 
-            readExpected(file, '[');
-            Uint8 next = peekNextCharacter(file);
+            readExpected(pos, end, '[');
+            char next = peekNextCharacter(pos, end);
             if (next == ']') {
-                readExpected(file, ']');
+                pos++;
             } else {
                 do {
-                    value.add(parseValue(file));
-                    next = peekNextCharacter(file);
+                    // Numbers are collected without nodes until the first item of another type
+                    if (onlyNumbers && isNumberStart(peekNextCharacter(pos, end))) {
+                        numberStack.push_back(readNumber(pos, end));
+                    } else {
+                        if (onlyNumbers) {
+                            onlyNumbers = false;
+                            for (Size i = numberBase; i < numberStack.size(); i++) {
+                                document.numbers.push_back(numberStack[i]);
+                                itemStack.push_back(document.addNode(Document::NodeType::Number, document.numbers.size() - 1, 0));
+                            }
+                            numberStack.resize(numberBase);
+                        }
+                        itemStack.push_back(parseValue(document, pos, end));
+                    }
 
+                    next = peekNextCharacter(pos, end);
                     if (next != ',' && next != ']') {
-                        D6_THROW(JsonException, std::string("Expect next item or end of array, got: ") + (char) next);
+                        D6_THROW(JsonException, std::string("Expect next item or end of array, got: ") + next);
                     }
-
-                    readExpected(file, (char) next);
+                    pos++;
                 } while (next == ',');
             }
 
-            return value;
-        }
+            if (!onlyNumbers) {
+                Size first = document.items.size();
+                document.items.insert(document.items.end(), itemStack.begin() + itemBase, itemStack.end());
+                itemStack.resize(itemBase);
+                return document.addNode(Document::NodeType::Array, first, document.items.size() - first);
+            }
 
-        Value Parser::parseString(File &file) const {
-            readExpected(file, '"');
-            std::string val = readUntil(file, stringSentinel);
-            readExpected(file, '"');
-            return Value::makeString(val);
+            bool integers = std::all_of(numberStack.begin() + numberBase, numberStack.end(), [](Float64 number) {
+                return number >= INT32_MIN && number <= INT32_MAX && number == Float64(Int32(number));
+            });
+            Size length = numberStack.size() - numberBase;
+            Uint32 node;
+            if (integers) {
+                node = document.addNode(Document::NodeType::IntArray, document.integers.size(), length);
+                for (Size i = numberBase; i < numberStack.size(); i++) {
+                    document.integers.push_back(Int32(numberStack[i]));
+                }
+            } else {
+                node = document.addNode(Document::NodeType::NumberArray, document.numbers.size(), length);
+                document.numbers.insert(document.numbers.end(), numberStack.begin() + numberBase, numberStack.end());
+            }
+            numberStack.resize(numberBase);
+            return node;
         }
 
-        Value Parser::parseNumber(File &file) const {
-            std::string val = readWhile(file, numberChars);
-            return Value::makeNumber(std::stod(val));
+        Uint32 Parser::parseString(Document &document, const char *&pos, const char *end) {
+            const char *value = readString(pos, end);
+            Size first = document.characters.size();
+            document.characters.append(value, pos - 1);
+            return document.addNode(Document::NodeType::String, first, document.characters.size() - first);
         }
 
-        Value Parser::parseBoolean(File &file) const {
-            Uint8 byte = peekNextCharacter(file);
-            bool val = (byte == 't');
-            readExpected(file, val ? "true" : "false");
-            return Value::makeBoolean(val);
+        Uint32 Parser::parseNumber(Document &document, const char *&pos, const char *end) {
+            document.numbers.push_back(readNumber(pos, end));
+            return document.addNode(Document::NodeType::Number, document.numbers.size() - 1, 0);
         }
 
-        Uint8 Parser::peekNextCharacter(File &file) const {
-            while (!file.isEof()) {
-                Uint8 byte;
-                file.read(&byte, 1, 1);
-
-                if (byte != ' ' && byte != '\t' && byte != '\n' && byte != '\r') {
-                    file.seek(-1, File::Seek::Cur);
-                    return byte;
-                }
-            }
-
-            D6_THROW(JsonException, "Unexpected end of input stream while skipping whitespace");
+        Uint32 Parser::parseBoolean(Document &document, const char *&pos, const char *end) {
+            bool val = (*pos == 't');
+            readExpected(pos, end, val ? "true" : "false");
+            return document.addNode(Document::NodeType::Boolean, val ? 1 : 0, 0);
         }
 
-        Value::Type Parser::determineValueType(Uint8 firstByte) const {
-            if (firstByte == '{') {
-                return Value::Type::Object;
-            } else if (firstByte == '[') {
-                return Value::Type::Array;
-            } else if (firstByte == '"') {
-                return Value::Type::String;
-            } else if (firstByte == 't' || firstByte == 'f') {
-                return Value::Type::Boolean;
-            } else if ((firstByte >= '0' && firstByte <= '9') || firstByte == '-' || firstByte == '.') {
-                return Value::Type::Number;
-            } else if (firstByte == 'n') {
-                return Value::Type::Null;
+        Float64 Parser::readNumber(const char *&pos, const char *end) const {
+            const char *numberEnd = pos;
+            while (isNumberCharacter(*numberEnd)) {
+                numberEnd++;
             }
 
-            D6_THROW(JsonException, std::string("Invalid value type found, starting with: ") + (char) firstByte);
-        }
-
-        void Parser::readExpected(File &file, const std::string &expected) const {
-            for (char chr : expected) {
-                readExpected(file, chr);
+#ifdef __cpp_lib_to_chars
+            Float64 number;
+            auto result = std::from_chars(pos, numberEnd, number);
+            if (result.ec != std::errc() || result.ptr != numberEnd) {
+                D6_THROW(JsonException, "Invalid number: " + std::string(pos, numberEnd));
             }
-        }
-
-        void Parser::readExpected(File &file, char expected) const {
-            Uint8 byte;
-            file.read(&byte, 1, 1);
-            if (expected != byte) {
-                D6_THROW(JsonException, std::string("Parsing error - expected: ") + expected + ", got: " + (char) byte);
+#else
+            // Standard libraries without floating-point from_chars (libc++ before LLVM 20, libstdc++ before GCC 11)
+            std::string text(pos, numberEnd);
+            char *parsedEnd = nullptr;
+            errno = 0;
+            Float64 number = std::strtod(text.c_str(), &parsedEnd);
+            if (errno == ERANGE || text.empty() || parsedEnd != text.c_str() + text.size()) {
+                D6_THROW(JsonException, "Invalid number: " + text);
             }
-        }
+#endif
 
-        void Parser::readWhitespaceAndExpected(File &file, char expected) const {
-            peekNextCharacter(file);
-            readExpected(file, expected);
+            pos = numberEnd;
+            return number;
         }
 
-        std::string Parser::readUntil(File &file, const std::unordered_set<Uint8> &sentinels) const {
-            std::string result;
-
-            while (!file.isEof()) {
-                Uint8 byte;
-                file.read(&byte, 1, 1);
-                if (sentinels.find(byte) != sentinels.end()) {
-                    file.seek(-1, File::Seek::Cur);
-                    return result;
-                } else {
-                    result += (char) byte;
+        const char *Parser::readString(const char *&pos, const char *end) const {
+            // Strings are taken verbatim up to the closing quote, the writer does not escape them either
+            readExpected(pos, end, '"');
+            const char *stringEnd = findStringEnd(pos);
+            while (*stringEnd != '"') {
+                if (stringEnd >= end) {
+                    D6_THROW(JsonException, "Unexpected end of input stream while looking for sentinel");
                 }
+                stringEnd = findStringEnd(stringEnd + 1);
             }
 
-            D6_THROW(JsonException, "Unexpected end of input stream while looking for sentinel");
+            const char *value = pos;
+            pos = stringEnd + 1;
+            return value;
         }
 
-        std::string Parser::readWhile(File &file, const std::unordered_set<Uint8> &allowed) const {
-            std::string result;
+        char Parser::peekNextCharacter(const char *&pos, const char *end) const {
+            pos = skipWhitespace(pos);
+            if (pos >= end) {
+                D6_THROW(JsonException, "Unexpected end of input stream while skipping whitespace");
+            }
+            return *pos;
+        }
 
-            while (!file.isEof()) {
-                Uint8 byte;
-                file.read(&byte, 1, 1);
-                if (allowed.find(byte) == allowed.end()) {
-                    file.seek(-1, File::Seek::Cur);
-                    break;
-                } else {
-                    result += (char) byte;
-                }
+        void Parser::readExpected(const char *&pos, const char *end, const char *expected) const {
+            for (; *expected != '\0'; expected++) {
+                readExpected(pos, end, *expected);
             }
+        }
 
-            return result;
+        void Parser::readExpected(const char *&pos, const char *end, char expected) const {
+            if (pos >= end || *pos != expected) {
+                D6_THROW(JsonException, std::string("Parsing error - expected: ") + expected + ", got: " +
+                                        (pos < end ? *pos : '?'));
+            }
+            pos++;
         }
     }
-}
\ No newline at end of file
+}
@@ -28,46 +28,62 @@
 #ifndef DUEL6_JSON_JSONPARSER_H
 #define DUEL6_JSON_JSONPARSER_H
 
+#include <vector>
 #include "../Type.h"
+#include "JsonDocument.h"
 #include "JsonValue.h"
 
 namespace Duel6 {
     namespace Json {
+        /** Parses a whole file loaded into memory, the text is scanned with a pointer */
         class Parser {
         public:
-            Value parse(const std::string &fileName) const;
+            // Zero bytes after the end of the text, vector loads may read up to 16 bytes past the current position
+            static const Size PADDING = 16;
 
         private:
-            Uint8 peekNextCharacter(File &file) const;
+            // Items of the arrays and objects being parsed, moved to the document once complete
+            std::vector<Uint32> itemStack;
+            std::vector<Document::Member> memberStack;
+            std::vector<Float64> numberStack;
 
-            void readExpected(File &file, const std::string &expected) const;
+        public:
+            Value parse(const std::string &fileName);
+
+            Document parseDocument(const std::string &fileName);
+
+            /** Parses the text which is followed by at least PADDING zero bytes */
+            Document parseDocument(const char *begin, const char *end);
 
-            void readExpected(File &file, char expected) const;
+            /** Loads the file followed by PADDING zero bytes */
+            static std::vector<char> load(const std::string &fileName);
 
-            void readWhitespaceAndExpected(File &file, char expected) const;
+        private:
+            Uint32 parseValue(Document &document, const char *&pos, const char *end);
+
+            Uint32 parseNull(Document &document, const char *&pos, const char *end);
 
-            std::string readUntil(File &file, const std::unordered_set<Uint8> &sentinels) const;
+            Uint32 parseObject(Document &document, const char *&pos, const char *end);
 
-            std::string readWhile(File &file, const std::unordered_set<Uint8> &allowed) const;
+            Uint32 parseArray(Document &document, const char *&pos, const char *end);
 
-            Value::Type determineValueType(Uint8 firstByte) const;
+            Uint32 parseNumber(Document &document, const char *&pos, const char *end);
 
-            Value parseValue(File &file) const;
+            Uint32 parseString(Document &document, const char *&pos, const char *end);
 
-            Value parseNull(File &file) const;
+            Uint32 parseBoolean(Document &document, const char *&pos, const char *end);
 
-            Value parseObject(File &file) const;
+            Float64 readNumber(const char *&pos, const char *end) const;
 
-            Value parseArray(File &file) const;
+            const char *readString(const char *&pos, const char *end) const;
 
-            Value parseNumber(File &file) const;
+            char peekNextCharacter(const char *&pos, const char *end) const;
 
-            Value parseString(File &file) const;
+            void readExpected(const char *&pos, const char *end, const char *expected) const;
 
-            Value parseBoolean(File &file) const;
+            void readExpected(const char *&pos, const char *end, char expected) const;
         };
     }
 }
 
-
 #endif
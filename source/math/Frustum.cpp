@@ -0,0 +1,58 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "Frustum.h"
+
+namespace Duel6 {
+    Frustum::Frustum() {
+        planes.fill(Plane{Vector::ZERO, 1.0f});
+    }
+
+    Frustum::Frustum(const Matrix &projectionView) {
+        // Each plane is the last row of the matrix plus or minus one of the remaining rows
+        const Matrix &m = projectionView;
+        for (Int32 i = 0; i < 6; i++) {
+            Int32 row = i / 2;
+            Float32 sign = (i % 2 == 0) ? 1.0f : -1.0f;
+            planes[i].normal = Vector(m(0, 3) + sign * m(0, row), m(1, 3) + sign * m(1, row),
+                                      m(2, 3) + sign * m(2, row));
+            planes[i].distance = m(3, 3) + sign * m(3, row);
+        }
+    }
+
+    bool Frustum::isVisible(const Vector &min, const Vector &max) const {
+        for (const Plane &plane : planes) {
+            // The corner of the box furthest along the plane normal
+            Vector corner(plane.normal.x >= 0 ? max.x : min.x, plane.normal.y >= 0 ? max.y : min.y,
+                          plane.normal.z >= 0 ? max.z : min.z);
+            if (plane.normal.dot(corner) + plane.distance < 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
@@ -30,26 +30,43 @@
 #include "Math.h"
 
 namespace Duel6 {
-    std::random_device Math::randomDevice;
-    std::default_random_engine Math::randomEngine(randomDevice());
+    thread_local Math::RandomEngine *Math::randomEngine = nullptr;
     const Float64 Math::Pi = 3.14159265358979323846;
 
+    Math::RandomScope::RandomScope(RandomEngine &engine)
+            : previous(randomEngine) {
+        randomEngine = &engine;
+    }
+
+    Math::RandomScope::~RandomScope() {
+        randomEngine = previous;
+    }
+
+    Math::RandomEngine &Math::getRandomEngine() {
+        if (randomEngine != nullptr) {
+            return *randomEngine;
+        }
+
+        thread_local RandomEngine threadEngine(std::random_device{}());
+        return threadEngine;
+    }
+
     Int32 Math::random(Int32 max) {
         return random(0, max - 1);
     }
 
     Int32 Math::random(Int32 min, Int32 max) {
         std::uniform_int_distribution<> uniformDistribution(min, max);
-        return uniformDistribution(randomEngine);
+        return uniformDistribution(getRandomEngine());
     }
 
     Float32 Math::random(Float32 min, Float32 max) {
         std::uniform_real_distribution<Float32> uniformDistribution(min, max);
-        return uniformDistribution(randomEngine);
+        return uniformDistribution(getRandomEngine());
     }
 
     Float64 Math::random(Float64 min, Float64 max) {
         std::uniform_real_distribution<Float64> uniformDistribution(min, max);
-        return uniformDistribution(randomEngine);
+        return uniformDistribution(getRandomEngine());
     }
 }
\ No newline at end of file
@@ -36,10 +36,29 @@
 
 namespace Duel6 {
     class Math {
+    public:
+        typedef std::default_random_engine RandomEngine;
+
+        /** Makes random() use the given engine on the current thread until the scope ends */
+        class RandomScope {
+        private:
+            RandomEngine *previous;
+
+        public:
+            explicit RandomScope(RandomEngine &engine);
+
+            ~RandomScope();
+
+            RandomScope(const RandomScope &) = delete;
+
+            RandomScope &operator=(const RandomScope &) = delete;
+        };
+
     public:
         static const Float64 Pi;
-        static std::random_device randomDevice;
-        static std::default_random_engine randomEngine;
+
+    private:
+        static thread_local RandomEngine *randomEngine;
 
     public:
         template<class T>
@@ -107,6 +126,9 @@ namespace Duel6 {
             return std::min(diff, 360.0f - diff);
         }
 
+        /** The engine of the innermost RandomScope or an engine of the current thread seeded by the system */
+        static RandomEngine &getRandomEngine();
+
         static Int32 random(Int32 max);
 
         static Int32 random(Int32 min, Int32 max);
@@ -0,0 +1,216 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "DrawList.h"
+#include "../VideoException.h"
+
+namespace Duel6 {
+    DrawList::DrawList()
+            : stateChanges(0) {
+        states.fill(-1);
+    }
+
+    void DrawList::clear() {
+        commands.clear();
+        vectors.clear();
+        colors.clear();
+        materials.clear();
+        matrices.clear();
+        states.fill(-1);
+        RendererBase::setModelMatrix(Matrix::IDENTITY);
+    }
+
+    void DrawList::replay(Renderer &renderer) const {
+        for (const Command &command : commands) {
+            // Points and texture coordinates of primitives
+            const Vector *v = vectors.data() + (command.type <= CommandType::TexturedQuad ? command.value : 0);
+            switch (command.type) {
+                case CommandType::Point:
+                    renderer.point(v[0], command.size, colors[command.color]);
+                    break;
+                case CommandType::Line:
+                    renderer.line(v[0], v[1], command.size, colors[command.color]);
+                    break;
+                case CommandType::Triangle:
+                    renderer.triangle(v[0], v[1], v[2], colors[command.color]);
+                    break;
+                case CommandType::TexturedTriangle:
+                    renderer.triangle(v[0], v[1], v[2], v[3], v[4], v[5], materials[command.color]);
+                    break;
+                case CommandType::Quad:
+                    renderer.quad(v[0], v[1], v[2], v[3], colors[command.color]);
+                    break;
+                case CommandType::TexturedQuad:
+                    renderer.quad(v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], materials[command.color]);
+                    break;
+                case CommandType::ModelMatrix:
+                    renderer.setModelMatrix(matrices[command.value]);
+                    break;
+                case CommandType::Wireframe:
+                    renderer.enableWireframe(command.value != 0);
+                    break;
+                case CommandType::DepthTest:
+                    renderer.enableDepthTest(command.value != 0);
+                    break;
+                case CommandType::DepthWrite:
+                    renderer.enableDepthWrite(command.value != 0);
+                    break;
+                case CommandType::BlendFunc:
+                    renderer.setBlendFunc(BlendFunc(command.value));
+                    break;
+            }
+        }
+    }
+
+    Renderer::Info DrawList::getInfo() {
+        Info info;
+        info.vendor = "None";
+        info.renderer = "Draw list";
+        info.version = "0";
+        return info;
+    }
+
+    Renderer::Extensions DrawList::getExtensions() {
+        return Extensions();
+    }
+
+    Texture DrawList::createTexture(const Image &image, TextureFilter filtering, bool clamp) {
+        D6_THROW(VideoException, "Draw list can't create textures");
+    }
+
+    void DrawList::freeTexture(Texture textureId) {
+        D6_THROW(VideoException, "Draw list can't free textures");
+    }
+
+    Image DrawList::makeScreenshot() {
+        return Image();
+    }
+
+    void DrawList::setViewport(Int32 x, Int32 y, Int32 width, Int32 height) {}
+
+    void DrawList::setModelMatrix(const Matrix &m) {
+        RendererBase::setModelMatrix(m);
+        addState(CommandType::ModelMatrix, Uint32(matrices.size()));
+        matrices.push_back(m);
+    }
+
+    void DrawList::enableWireframe(bool enable) {
+        addPipelineState(CommandType::Wireframe, enable);
+    }
+
+    void DrawList::enableDepthTest(bool enable) {
+        addPipelineState(CommandType::DepthTest, enable);
+    }
+
+    void DrawList::enableDepthWrite(bool enable) {
+        addPipelineState(CommandType::DepthWrite, enable);
+    }
+
+    void DrawList::setBlendFunc(BlendFunc func) {
+        addPipelineState(CommandType::BlendFunc, Uint32(func));
+    }
+
+    Uint32 DrawList::getStateChanges() const {
+        return stateChanges;
+    }
+
+    void DrawList::applyWireframe(bool enable) {}
+
+    void DrawList::applyDepthTest(bool enable) {}
+
+    void DrawList::applyDepthWrite(bool enable) {}
+
+    void DrawList::applyBlendFunc(BlendFunc func) {}
+
+    void DrawList::setGlobalTime(Float32 time) {}
+
+    void DrawList::clearBuffers() {}
+
+    void DrawList::point(const Vector &position, Float32 size, const Color &color) {
+        add(CommandType::Point, {position}, color, size);
+    }
+
+    void DrawList::line(const Vector &from, const Vector &to, Float32 width, const Color &color) {
+        add(CommandType::Line, {from, to}, color, width);
+    }
+
+    void DrawList::triangle(const Vector &p1, const Vector &p2, const Vector &p3, const Color &color) {
+        add(CommandType::Triangle, {p1, p2, p3}, color);
+    }
+
+    void DrawList::triangle(const Vector &p1, const Vector &t1,
+                            const Vector &p2, const Vector &t2,
+                            const Vector &p3, const Vector &t3,
+                            const Material &material) {
+        add(CommandType::TexturedTriangle, {p1, t1, p2, t2, p3, t3}, material);
+    }
+
+    void DrawList::quad(const Vector &p1, const Vector &p2, const Vector &p3, const Vector &p4, const Color &color) {
+        add(CommandType::Quad, {p1, p2, p3, p4}, color);
+    }
+
+    void DrawList::quad(const Vector &p1, const Vector &t1,
+                        const Vector &p2, const Vector &t2,
+                        const Vector &p3, const Vector &t3,
+                        const Vector &p4, const Vector &t4,
+                        const Material &material) {
+        add(CommandType::TexturedQuad, {p1, t1, p2, t2, p3, t3, p4, t4}, material);
+    }
+
+    std::unique_ptr<RendererBuffer> DrawList::makeBuffer(const FaceList &faceList) {
+        D6_THROW(VideoException, "Draw list can't create buffers");
+    }
+
+    std::unique_ptr<RendererTarget> DrawList::makeTarget(ScreenParameters screenParameters) {
+        D6_THROW(VideoException, "Draw list can't create render targets");
+    }
+
+    void DrawList::add(CommandType type, std::initializer_list<Vector> points, const Color &color, Float32 size) {
+        commands.push_back(Command{type, Uint32(vectors.size()), Uint32(colors.size()), size});
+        vectors.insert(vectors.end(), points);
+        colors.push_back(color);
+    }
+
+    void DrawList::add(CommandType type, std::initializer_list<Vector> points, const Material &material) {
+        commands.push_back(Command{type, Uint32(vectors.size()), Uint32(materials.size()), 0});
+        vectors.insert(vectors.end(), points);
+        materials.push_back(material);
+    }
+
+    void DrawList::addState(CommandType type, Uint32 value) {
+        commands.push_back(Command{type, value, 0, 0});
+    }
+
+    void DrawList::addPipelineState(CommandType type, Uint32 value) {
+        Int32 &state = states[Size(type) - Size(CommandType::Wireframe)];
+        if (state != Int32(value)) {
+            state = Int32(value);
+            stateChanges++;
+            addState(type, value);
+        }
+    }
+}
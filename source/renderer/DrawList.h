@@ -0,0 +1,157 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef DUEL6_RENDERER_DRAWLIST_H
+#define DUEL6_RENDERER_DRAWLIST_H
+
+#include <array>
+#include <vector>
+#include "RendererBase.h"
+
+namespace Duel6 {
+    /**
+     * Renderer recording primitives, model matrices and pipeline state instead of drawing them. The recording
+     * is replayed by another renderer, e.g. once for every split screen view with its own viewport and camera.
+     * View and projection matrices are not recorded, they belong to the replaying renderer.
+     */
+    class DrawList
+            : public RendererBase {
+    private:
+        enum class CommandType : Uint8 {
+            Point,
+            Line,
+            Triangle,
+            TexturedTriangle,
+            Quad,
+            TexturedQuad,
+            ModelMatrix,
+            Wireframe,
+            DepthTest,
+            DepthWrite,
+            BlendFunc
+        };
+
+        struct Command {
+            CommandType type;
+            Uint32 value; // First vector, matrix, color or material, or the new state
+            Uint32 color;
+            Float32 size;
+        };
+
+        std::vector<Command> commands;
+        std::vector<Vector> vectors;
+        std::vector<Color> colors;
+        std::vector<Material> materials;
+        std::vector<Matrix> matrices;
+        // Last recorded value of each pipeline state, -1 until it is first set
+        std::array<Int32, 4> states;
+        Uint32 stateChanges;
+
+    public:
+        DrawList();
+
+        void clear();
+
+        void replay(Renderer &renderer) const;
+
+        Size getCommandCount() const {
+            return commands.size();
+        }
+
+        Info getInfo() override;
+
+        Extensions getExtensions() override;
+
+        Texture createTexture(const Image &image, TextureFilter filtering, bool clamp) override;
+
+        void freeTexture(Texture textureId) override;
+
+        Image makeScreenshot() override;
+
+        void setViewport(Int32 x, Int32 y, Int32 width, Int32 height) override;
+
+        void setModelMatrix(const Matrix &m) override;
+
+        // The first change of each state is always recorded because the state of the replaying renderer is unknown
+        void enableWireframe(bool enable) override;
+
+        void enableDepthTest(bool enable) override;
+
+        void enableDepthWrite(bool enable) override;
+
+        void setBlendFunc(BlendFunc func) override;
+
+        Uint32 getStateChanges() const override;
+
+        void setGlobalTime(Float32 time) override;
+
+        void clearBuffers() override;
+
+        void point(const Vector &position, Float32 size, const Color &color) override;
+
+        void line(const Vector &from, const Vector &to, Float32 width, const Color &color) override;
+
+        void triangle(const Vector &p1, const Vector &p2, const Vector &p3, const Color &color) override;
+
+        void triangle(const Vector &p1, const Vector &t1,
+                      const Vector &p2, const Vector &t2,
+                      const Vector &p3, const Vector &t3,
+                      const Material &material) override;
+
+        void quad(const Vector &p1, const Vector &p2, const Vector &p3, const Vector &p4, const Color &color) override;
+
+        void quad(const Vector &p1, const Vector &t1,
+                  const Vector &p2, const Vector &t2,
+                  const Vector &p3, const Vector &t3,
+                  const Vector &p4, const Vector &t4,
+                  const Material &material) override;
+
+        std::unique_ptr<RendererBuffer> makeBuffer(const FaceList &faceList) override;
+
+        std::unique_ptr<RendererTarget> makeTarget(ScreenParameters screenParameters) override;
+
+    protected:
+        void applyWireframe(bool enable) override;
+
+        void applyDepthTest(bool enable) override;
+
+        void applyDepthWrite(bool enable) override;
+
+        void applyBlendFunc(BlendFunc func) override;
+
+    private:
+        void add(CommandType type, std::initializer_list<Vector> points, const Color &color, Float32 size = 0);
+
+        void add(CommandType type, std::initializer_list<Vector> points, const Material &material);
+
+        void addState(CommandType type, Uint32 value);
+
+        void addPipelineState(CommandType type, Uint32 value);
+    };
+}
+
+#endif
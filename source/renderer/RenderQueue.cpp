@@ -0,0 +1,170 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "RenderQueue.h"
+
+namespace Duel6 {
+    namespace {
+        Uint64 getStateKey(const RenderQueue::State &state) {
+            return (Uint64(state.depthTest ? 1 : 0) << 3) | (Uint64(state.depthWrite ? 1 : 0) << 2) |
+                   Uint64(state.blendFunc);
+        }
+    }
+
+    void RenderQueue::point(Uint32 layer, const State &state, const Vector &position, Float32 size,
+                            const Color &color) {
+        Command command;
+        command.type = CommandType::Point;
+        command.position = position;
+        command.width = size;
+        command.color = color;
+        command.texture = 0;
+        command.state = state;
+        add(layer, command);
+    }
+
+    void RenderQueue::line(Uint32 layer, const State &state, const Vector &from, const Vector &to, Float32 width,
+                           const Color &color) {
+        Command command;
+        command.type = CommandType::Line;
+        command.position = from;
+        command.size = to;
+        command.width = width;
+        command.color = color;
+        command.texture = 0;
+        command.state = state;
+        add(layer, command);
+    }
+
+    void RenderQueue::quadXY(Uint32 layer, const State &state, const Vector &position, const Vector &size,
+                             const Color &color) {
+        Command command;
+        command.type = CommandType::Quad;
+        command.position = position;
+        command.size = size;
+        command.color = color;
+        command.texture = 0;
+        command.state = state;
+        add(layer, command);
+    }
+
+    void RenderQueue::quadXY(Uint32 layer, const State &state, const Vector &position, const Vector &size,
+                             const Vector &texturePosition, const Vector &textureSize, const Material &material) {
+        Command command;
+        command.type = CommandType::TexturedQuad;
+        command.position = position;
+        command.size = size;
+        command.texturePosition = texturePosition;
+        command.textureSize = textureSize;
+        command.color = material.getColor();
+        command.texture = material.getTexture();
+        command.masked = material.isMasked();
+        command.state = state;
+        add(layer, command);
+    }
+
+    void RenderQueue::add(Uint32 layer, const Command &command) {
+        // Layer, state, program and texture, the low bits are left for future use
+        Uint64 key = (Uint64(layer & 0xff) << 56) | (getStateKey(command.state) << 52) |
+                     (Uint64(command.type == CommandType::TexturedQuad ? 1 : 0) << 51) |
+                     (Uint64(Uint32(command.texture)) << 19);
+
+        entries.push_back({key, Uint32(commands.size())});
+        commands.push_back(command);
+    }
+
+    void RenderQueue::execute(Renderer &renderer) {
+        if (commands.empty()) {
+            return;
+        }
+
+        sort();
+
+        Uint32 stateChanges = renderer.getStateChanges();
+        for (const Entry &entry : entries) {
+            const Command &command = commands[entry.command];
+            apply(renderer, command.state);
+
+            switch (command.type) {
+                case CommandType::Point:
+                    renderer.point(command.position, command.width, command.color);
+                    break;
+                case CommandType::Line:
+                    renderer.line(command.position, command.size, command.width, command.color);
+                    break;
+                case CommandType::Quad:
+                    renderer.quadXY(command.position, command.size, command.color);
+                    break;
+                case CommandType::TexturedQuad:
+                    renderer.quadXY(command.position, command.size, command.texturePosition, command.textureSize,
+                                    Material(command.texture, command.color, command.masked));
+                    break;
+            }
+        }
+
+        apply(renderer, {true, true, BlendFunc::None});
+
+        stats.commands += Uint32(entries.size());
+        stats.stateChanges += renderer.getStateChanges() - stateChanges;
+
+        commands.clear();
+        entries.clear();
+    }
+
+    void RenderQueue::sort() {
+        // Stable LSD radix sort by bytes, passes where all keys share the byte are skipped
+        sortBuffer.resize(entries.size());
+
+        for (Uint32 shift = 0; shift < 64; shift += 8) {
+            Size counts[256] = {};
+            for (const Entry &entry : entries) {
+                counts[(entry.key >> shift) & 0xff]++;
+            }
+            if (counts[(entries.front().key >> shift) & 0xff] == entries.size()) {
+                continue;
+            }
+
+            Size offset = 0;
+            for (Size &count : counts) {
+                Size bucketSize = count;
+                count = offset;
+                offset += bucketSize;
+            }
+
+            for (const Entry &entry : entries) {
+                sortBuffer[counts[(entry.key >> shift) & 0xff]++] = entry;
+            }
+            entries.swap(sortBuffer);
+        }
+    }
+
+    void RenderQueue::apply(Renderer &renderer, const State &state) {
+        renderer.enableDepthTest(state.depthTest);
+        renderer.enableDepthWrite(state.depthWrite);
+        renderer.setBlendFunc(state.blendFunc);
+    }
+}
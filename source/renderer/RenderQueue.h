@@ -0,0 +1,120 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef DUEL6_RENDERER_RENDER_QUEUE_H
+#define DUEL6_RENDERER_RENDER_QUEUE_H
+
+#include <vector>
+#include "../Type.h"
+#include "../Color.h"
+#include "../Material.h"
+#include "../math/Vector.h"
+#include "Renderer.h"
+
+namespace Duel6 {
+    /**
+     * Collects draws with the pipeline state they need and renders them ordered by a sort key made of layer,
+     * depth test, depth write, blend function, program and texture. Draws with equal keys keep their order.
+     */
+    class RenderQueue {
+    public:
+        struct State {
+            bool depthTest;
+            bool depthWrite;
+            BlendFunc blendFunc;
+        };
+
+        struct Stats {
+            // Queued points, lines and quads, the renderer may batch several into one draw call
+            Uint32 commands = 0;
+            Uint32 stateChanges = 0;
+        };
+
+    private:
+        enum class CommandType : Uint8 {
+            Point,
+            Line,
+            Quad,
+            TexturedQuad
+        };
+
+        struct Command {
+            CommandType type;
+            Vector position; // Or start of a line
+            Vector size; // Or end of a line
+            Vector texturePosition;
+            Vector textureSize;
+            Float32 width;
+            Color color;
+            Texture texture;
+            bool masked;
+            State state;
+        };
+
+        struct Entry {
+            Uint64 key;
+            Uint32 command;
+        };
+
+    private:
+        std::vector<Command> commands;
+        std::vector<Entry> entries;
+        std::vector<Entry> sortBuffer;
+        Stats stats;
+
+    public:
+        void point(Uint32 layer, const State &state, const Vector &position, Float32 size, const Color &color);
+
+        void line(Uint32 layer, const State &state, const Vector &from, const Vector &to, Float32 width,
+                  const Color &color);
+
+        void quadXY(Uint32 layer, const State &state, const Vector &position, const Vector &size, const Color &color);
+
+        void quadXY(Uint32 layer, const State &state, const Vector &position, const Vector &size,
+                    const Vector &texturePosition, const Vector &textureSize, const Material &material);
+
+        /** Renders and removes all queued draws, the pipeline is left with depth test and depth write enabled and blending disabled */
+        void execute(Renderer &renderer);
+
+        const Stats &getStats() const {
+            return stats;
+        }
+
+        void resetStats() {
+            stats = Stats();
+        }
+
+    private:
+        void add(Uint32 layer, const Command &command);
+
+        void sort();
+
+        void apply(Renderer &renderer, const State &state);
+    };
+}
+
+#endif
@@ -92,6 +92,9 @@ namespace Duel6 {
 
         virtual void setBlendFunc(BlendFunc func) = 0;
 
+        /** Number of pipeline state changes passed to the backend so far */
+        virtual Uint32 getStateChanges() const = 0;
+
         virtual void setGlobalTime(Float32 time) = 0;
 
         virtual void clearBuffers() = 0;
@@ -136,6 +139,9 @@ namespace Duel6 {
         virtual std::unique_ptr<RendererBuffer> makeBuffer(const FaceList &faceList) = 0;
 
         virtual std::unique_ptr<RendererTarget> makeTarget(ScreenParameters screenParameters) = 0;
+
+        /** Finishes drawing of the current frame */
+        virtual void flush() = 0;
     };
 }
 
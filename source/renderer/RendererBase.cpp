@@ -29,7 +29,8 @@
 
 namespace Duel6 {
     RendererBase::RendererBase()
-            : projectionMatrix(Matrix::IDENTITY), viewMatrix(Matrix::IDENTITY), modelMatrix(Matrix::IDENTITY) {}
+            : projectionMatrix(Matrix::IDENTITY), viewMatrix(Matrix::IDENTITY), modelMatrix(Matrix::IDENTITY),
+              wireframe(false), depthTest(false), depthWrite(true), blendFunc(BlendFunc::None), stateChanges(0) {}
 
     void RendererBase::setProjectionMatrix(const Matrix &m) {
         projectionMatrix = m;
@@ -55,6 +56,42 @@ namespace Duel6 {
         return modelMatrix;
     }
 
+    void RendererBase::enableWireframe(bool enable) {
+        if (enable != wireframe) {
+            wireframe = enable;
+            stateChanges++;
+            applyWireframe(enable);
+        }
+    }
+
+    void RendererBase::enableDepthTest(bool enable) {
+        if (enable != depthTest) {
+            depthTest = enable;
+            stateChanges++;
+            applyDepthTest(enable);
+        }
+    }
+
+    void RendererBase::enableDepthWrite(bool enable) {
+        if (enable != depthWrite) {
+            depthWrite = enable;
+            stateChanges++;
+            applyDepthWrite(enable);
+        }
+    }
+
+    void RendererBase::setBlendFunc(BlendFunc func) {
+        if (func != blendFunc) {
+            blendFunc = func;
+            stateChanges++;
+            applyBlendFunc(func);
+        }
+    }
+
+    Uint32 RendererBase::getStateChanges() const {
+        return stateChanges;
+    }
+
     void RendererBase::quadXY(const Vector &position, const Vector &size, const Color &color) {
         Vector p2(position.x, position.y + size.y, position.z);
         Vector p3(position.x + size.x, position.y + size.y, position.z);
@@ -122,4 +159,7 @@ namespace Duel6 {
         line(p3, p4, width, color);
         line(p4, position, width, color);
     }
+
+    void RendererBase::flush() {
+    }
 }
@@ -41,6 +41,14 @@ namespace Duel6 {
         Matrix modelMatrix;
         Matrix mvpMatrix;
 
+    private:
+        // Shadow copy of the pipeline state, starts with the OpenGL defaults
+        bool wireframe;
+        bool depthTest;
+        bool depthWrite;
+        BlendFunc blendFunc;
+        Uint32 stateChanges;
+
     public:
         RendererBase();
 
@@ -56,6 +64,16 @@ namespace Duel6 {
 
         Matrix getModelMatrix() const override;
 
+        void enableWireframe(bool enable) override;
+
+        void enableDepthTest(bool enable) override;
+
+        void enableDepthWrite(bool enable) override;
+
+        void setBlendFunc(BlendFunc func) override;
+
+        Uint32 getStateChanges() const override;
+
         void quadXY(const Vector &position, const Vector &size, const Color &color) override;
 
         void quadXY(const Vector &position, const Vector &size, const Vector &texturePosition,
@@ -72,6 +90,17 @@ namespace Duel6 {
                     const Vector &textureSize, const Material &material) override;
 
         void frame(const Vector &position, const Vector &size, Float32 width, const Color &color) override;
+
+        void flush() override;
+
+    protected:
+        virtual void applyWireframe(bool enable) = 0;
+
+        virtual void applyDepthTest(bool enable) = 0;
+
+        virtual void applyDepthWrite(bool enable) = 0;
+
+        virtual void applyBlendFunc(BlendFunc func) = 0;
     };
 }
 
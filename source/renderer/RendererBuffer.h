@@ -39,6 +39,9 @@ namespace Duel6 {
 
         virtual void update(const FaceList &faceList) = 0;
 
+        /** Uploads the given faces again, the number of drawn faces changes to the current size of the list */
+        virtual void update(const FaceList &faceList, Size firstFace, Size faceCount) = 0;
+
         virtual void render(const Material &material) = 0;
     };
 }
@@ -28,8 +28,6 @@
 #include "GLES2Renderer.h"
 
 namespace Duel6 {
-    static float points[15];
-
     static const char *colorVertexShader =
             "attribute vec3 vp;"
                     "uniform mat4 mvp;"
@@ -168,18 +166,18 @@ namespace Duel6 {
         glViewport(x, y, width, height);
     }
 
-    void GLES2Renderer::enableWireframe(bool enable) {
+    void GLES2Renderer::applyWireframe(bool enable) {
     }
 
-    void GLES2Renderer::enableDepthTest(bool enable) {
+    void GLES2Renderer::applyDepthTest(bool enable) {
         enableOption(GL_DEPTH_TEST, enable);
     }
 
-    void GLES2Renderer::enableDepthWrite(bool enable) {
+    void GLES2Renderer::applyDepthWrite(bool enable) {
         glDepthMask(GLboolean(enable ? GL_TRUE : GL_FALSE));
     }
 
-    void GLES2Renderer::setBlendFunc(BlendFunc func) {
+    void GLES2Renderer::applyBlendFunc(BlendFunc func) {
         switch (func) {
             case BlendFunc::None:
                 glDisable(GL_BLEND);
@@ -41,6 +41,7 @@ namespace Duel6 {
         Matrix mvpMatrix;
         GLuint colorProgram;
         GLuint textureProgram;
+        float points[15];
 
     public:
         GLES2Renderer();
@@ -55,14 +56,6 @@ namespace Duel6 {
 
         void setViewport(Int32 x, Int32 y, Int32 width, Int32 height) override;
 
-        void enableWireframe(bool enable) override;
-
-        void enableDepthTest(bool enable) override;
-
-        void enableDepthWrite(bool enable) override;
-
-        void setBlendFunc(BlendFunc func) override;
-
         void clearBuffers() override;
 
         void point(const Vector &position, Float32 size, const Color &color) override;
@@ -78,6 +71,15 @@ namespace Duel6 {
 
     private:
         void enableOption(GLenum option, bool enable);
+
+    protected:
+        void applyWireframe(bool enable) override;
+
+        void applyDepthTest(bool enable) override;
+
+        void applyDepthWrite(bool enable) override;
+
+        void applyBlendFunc(BlendFunc func) override;
     };
 }
 
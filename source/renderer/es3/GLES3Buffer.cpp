@@ -33,18 +33,23 @@
 namespace Duel6 {
     GLES3Buffer::GLES3Buffer(GLES3Program &program, const FaceList &faceList)
             : program(program), elements(6 * faceList.getFaces().size()) {
+        Size faces = faceList.getFaces().size();
+        Size capacity = 6 * faceList.getCapacity();
+        GLenum usage = capacity > elements ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW;
+
         std::vector<Vertex> vertexBuffer;
-        createFaceListVertexBuffer(faceList, vertexBuffer);
+        createFaceListVertexBuffer(faceList, 0, faces, vertexBuffer);
 
         std::vector<Float32> textureIndexBuffer;
-        createFaceListTextureIndexBuffer(faceList, textureIndexBuffer);
+        createFaceListTextureIndexBuffer(faceList, 0, faces, textureIndexBuffer);
 
         glGenVertexArrays(1, &vao);
         glBindVertexArray(vao);
 
         glGenBuffers(1, &vertexVbo);
         glBindBuffer(GL_ARRAY_BUFFER, vertexVbo);
-        glBufferData(GL_ARRAY_BUFFER, vertexBuffer.size() * sizeof(Vertex), vertexBuffer.data(), GL_STATIC_DRAW);
+        glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(Vertex), nullptr, usage);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, vertexBuffer.size() * sizeof(Vertex), vertexBuffer.data());
         //glNamedBufferStorage(vertexVbo, vertexBuffer.size() * sizeof(Float32), vertexBuffer.data(), 0); // GL 4.5
 
         glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), nullptr);
@@ -56,8 +61,8 @@ namespace Duel6 {
 
         glGenBuffers(1, &textureIndexVbo);
         glBindBuffer(GL_ARRAY_BUFFER, textureIndexVbo);
-        glBufferData(GL_ARRAY_BUFFER, textureIndexBuffer.size() * sizeof(Float32), textureIndexBuffer.data(),
-                     GL_STATIC_DRAW);
+        glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(Float32), nullptr, GL_DYNAMIC_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, textureIndexBuffer.size() * sizeof(Float32), textureIndexBuffer.data());
         //glNamedBufferStorage(textureIndexVbo, textureIndexBuffer.size() * sizeof(Float32), textureIndexBuffer.data(), 0); // GL 4.5
 
         glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, 0, nullptr);
@@ -75,15 +80,32 @@ namespace Duel6 {
 
     void GLES3Buffer::update(const FaceList &faceList) {
         std::vector<Float32> textureIndexBuffer;
-        createFaceListTextureIndexBuffer(faceList, textureIndexBuffer);
+        createFaceListTextureIndexBuffer(faceList, 0, faceList.getFaces().size(), textureIndexBuffer);
 
         glBindBuffer(GL_ARRAY_BUFFER, textureIndexVbo);
-        glBufferData(GL_ARRAY_BUFFER, textureIndexBuffer.size() * sizeof(Float32), textureIndexBuffer.data(),
-                     GL_STATIC_DRAW);
-        // glBufferSubData(GL_ARRAY_BUFFER, 0, elements * sizeof(Float32), textureIndexBuffer.data());
+        glBufferSubData(GL_ARRAY_BUFFER, 0, textureIndexBuffer.size() * sizeof(Float32), textureIndexBuffer.data());
         // glNamedBufferSubData(textureIndexVbo, 0, elements * sizeof(Float32), textureIndexBuffer.data()); // GL 4.5
     }
 
+    void GLES3Buffer::update(const FaceList &faceList, Size firstFace, Size faceCount) {
+        elements = 6 * faceList.getFaces().size();
+        if (faceCount == 0) {
+            return;
+        }
+
+        std::vector<Vertex> vertexBuffer;
+        createFaceListVertexBuffer(faceList, firstFace, faceCount, vertexBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, vertexVbo);
+        glBufferSubData(GL_ARRAY_BUFFER, 6 * firstFace * sizeof(Vertex), vertexBuffer.size() * sizeof(Vertex),
+                        vertexBuffer.data());
+
+        std::vector<Float32> textureIndexBuffer;
+        createFaceListTextureIndexBuffer(faceList, firstFace, faceCount, textureIndexBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, textureIndexVbo);
+        glBufferSubData(GL_ARRAY_BUFFER, 6 * firstFace * sizeof(Float32), textureIndexBuffer.size() * sizeof(Float32),
+                        textureIndexBuffer.data());
+    }
+
     void GLES3Buffer::render(const Material &material) {
         glBindVertexArray(vao);
         program.bind();
@@ -101,11 +123,9 @@ namespace Duel6 {
     }
 
 
-    void GLES3Buffer::createFaceListVertexBuffer(const FaceList &faceList, std::vector<Vertex> &vertexBuffer) {
-        const Vertex *vertex = faceList.getVertexes().data();
-        const auto &faces = faceList.getFaces();
-
-        const auto faceCount = faces.size();
+    void GLES3Buffer::createFaceListVertexBuffer(const FaceList &faceList, Size firstFace, Size faceCount,
+                                                 std::vector<Vertex> &vertexBuffer) {
+        const Vertex *vertex = faceList.getVertexes().data() + 4 * firstFace;
         vertexBuffer.reserve(faceCount * 6);
 
         for (Size i = 0; i < faceCount; i++, vertex += 4) {
@@ -123,12 +143,14 @@ namespace Duel6 {
         }
     }
 
-    void GLES3Buffer::createFaceListTextureIndexBuffer(const FaceList &faceList, std::vector<Float32> &textureIndexBuffer) {
+    void GLES3Buffer::createFaceListTextureIndexBuffer(const FaceList &faceList, Size firstFace, Size faceCount,
+                                                       std::vector<Float32> &textureIndexBuffer) {
         const auto &faces = faceList.getFaces();
-        textureIndexBuffer.reserve(faces.size() * 6);
+        textureIndexBuffer.reserve(faceCount * 6);
 
-        for (const Face &face : faces) {
-            Float32 textureIndex = face.getCurrentTexture();
+        for (Size i = firstFace; i < firstFace + faceCount; i++) {
+            const Face &face = faces[i];
+            Float32 textureIndex = face.getTexture(faceList.getAnimationFrame());
             textureIndexBuffer.push_back(textureIndex);
             textureIndexBuffer.push_back(textureIndex);
             textureIndexBuffer.push_back(textureIndex);
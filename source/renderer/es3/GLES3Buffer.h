@@ -49,12 +49,16 @@ namespace Duel6 {
 
         void update(const FaceList &faceList) override;
 
+        void update(const FaceList &faceList, Size firstFace, Size faceCount) override;
+
         void render(const Material &material) override;
 
     private:
-        void createFaceListVertexBuffer(const FaceList &faceList, std::vector<Vertex> &vertexBuffer);
+        void createFaceListVertexBuffer(const FaceList &faceList, Size firstFace, Size faceCount,
+                                        std::vector<Vertex> &vertexBuffer);
 
-        void createFaceListTextureIndexBuffer(const FaceList &faceList, std::vector<Float32> &textureIndexBuffer);
+        void createFaceListTextureIndexBuffer(const FaceList &faceList, Size firstFace, Size faceCount,
+                                              std::vector<Float32> &textureIndexBuffer);
     };
 }
 
@@ -30,18 +30,6 @@
 #include "GLES3RendererTarget.h"
 
 namespace Duel6 {
-    struct ColorVertex {
-        Vector xyz;
-    };
-    static ColorVertex colorPoints[4];
-
-    struct MaterialVertex {
-        Vector xyz; // Position
-        Vector str; // Texture coordinates
-        Uint32 flags = 0;
-    };
-    static MaterialVertex materialPoints[4];
-
     GLES3Renderer::GLES3Renderer()
             : RendererBase(),
               colorVertexShader(GL_VERTEX_SHADER, "shaders/gles3/colorVertex.glsl"),
@@ -145,19 +133,19 @@ namespace Duel6 {
         glViewport(x, y, width, height);
     }
 
-    void GLES3Renderer::enableWireframe(bool enable) {
+    void GLES3Renderer::applyWireframe(bool enable) {
         glPolygonMode(GL_FRONT_AND_BACK, enable ? GL_LINE : GL_FILL);
     }
 
-    void GLES3Renderer::enableDepthTest(bool enable) {
+    void GLES3Renderer::applyDepthTest(bool enable) {
         enableOption(GL_DEPTH_TEST, enable);
     }
 
-    void GLES3Renderer::enableDepthWrite(bool enable) {
+    void GLES3Renderer::applyDepthWrite(bool enable) {
         glDepthMask(GLboolean(enable ? GL_TRUE : GL_FALSE));
     }
 
-    void GLES3Renderer::setBlendFunc(BlendFunc func) {
+    void GLES3Renderer::applyBlendFunc(BlendFunc func) {
         switch (func) {
             case BlendFunc::None:
                 glDisable(GL_BLEND);
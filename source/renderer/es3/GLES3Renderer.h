@@ -38,6 +38,20 @@ namespace Duel6 {
     class GLES3Renderer
             : public RendererBase {
     private:
+        struct ColorVertex {
+            Vector xyz;
+        };
+
+        struct MaterialVertex {
+            Vector xyz; // Position
+            Vector str; // Texture coordinates
+            Uint32 flags = 0;
+        };
+
+    private:
+        // Vertices of the primitive being drawn, kept per renderer so that renderers do not share memory
+        ColorVertex colorPoints[4];
+        MaterialVertex materialPoints[4];
         GLuint colorVao;
         GLuint colorVbo;
         GLuint materialVbo;
@@ -65,14 +79,6 @@ namespace Duel6 {
 
         void setViewport(Int32 x, Int32 y, Int32 width, Int32 height) override;
 
-        void enableWireframe(bool enable) override;
-
-        void enableDepthTest(bool enable) override;
-
-        void enableDepthWrite(bool enable) override;
-
-        void setBlendFunc(BlendFunc func) override;
-
         void setGlobalTime(Float32 time) override;
 
         void clearBuffers() override;
@@ -114,6 +120,15 @@ namespace Duel6 {
         void updateMaterialBuffer(Int32 vertexCount);
 
         void updateMvpUniform();
+
+    protected:
+        void applyWireframe(bool enable) override;
+
+        void applyDepthTest(bool enable) override;
+
+        void applyDepthWrite(bool enable) override;
+
+        void applyBlendFunc(BlendFunc func) override;
     };
 }
 
@@ -25,6 +25,7 @@
 * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <algorithm>
 #include <vector>
 #include "GL1Buffer.h"
 #include "GL1Renderer.h"
@@ -46,6 +47,9 @@ namespace Duel6 {
     void GL1Buffer::update(const FaceList &faceList) {
     }
 
+    void GL1Buffer::update(const FaceList &faceList, Size firstFace, Size faceCount) {
+    }
+
     void GL1Buffer::render(const Material &material) {
         const auto &faces = faceList.getFaces();
         const Vertex *vertex = faceList.getVertexes().data();
@@ -56,18 +60,46 @@ namespace Duel6 {
             const Vertex &v3 = vertex[2];
             const Vertex &v4 = vertex[3];
 
-            Float32 currentTexture = face.getCurrentTexture();
+            Float32 currentTexture = face.getTexture(faceList.getAnimationFrame());
 
-            renderer.quad(getVertexPosition(v1), Vector(v1.u, v1.v, currentTexture),
-                          getVertexPosition(v2), Vector(v2.u, v2.v, currentTexture),
-                          getVertexPosition(v3), Vector(v3.u, v3.v, currentTexture),
-                          getVertexPosition(v4), Vector(v4.u, v4.v, currentTexture),
-                          material);
+            if (v3.u > 1.0f || v3.v > 1.0f) {
+                renderTiled(v1, v2, v3, v4, currentTexture, material);
+            } else {
+                renderer.quad(getVertexPosition(v1), Vector(v1.u, v1.v, currentTexture),
+                              getVertexPosition(v2), Vector(v2.u, v2.v, currentTexture),
+                              getVertexPosition(v3), Vector(v3.u, v3.v, currentTexture),
+                              getVertexPosition(v4), Vector(v4.u, v4.v, currentTexture),
+                              material);
+            }
 
             vertex += 4;
         }
     }
 
+    void GL1Buffer::renderTiled(const Vertex &v1, const Vertex &v2, const Vertex &v3, const Vertex &v4,
+                                Float32 texture, const Material &material) {
+        // Textures are clamped, so a merged face is split back into one quad per covered block
+        Vector p1 = getVertexPosition(v1), p2 = getVertexPosition(v2);
+        Vector p3 = getVertexPosition(v3), p4 = getVertexPosition(v4);
+        auto position = [&](Float32 u, Float32 v) {
+            Float32 s = u / v3.u, t = v / v3.v;
+            return (p1 * (1 - s) + p2 * s) * (1 - t) + (p4 * (1 - s) + p3 * s) * t;
+        };
+
+        for (Float32 vStart = 0; vStart < v3.v; vStart += 1.0f) {
+            Float32 vEnd = std::min(vStart + 1.0f, v3.v);
+            for (Float32 uStart = 0; uStart < v3.u; uStart += 1.0f) {
+                Float32 uEnd = std::min(uStart + 1.0f, v3.u);
+                Float32 u = std::min(uEnd - uStart, 0.99f), v = std::min(vEnd - vStart, 0.99f);
+                renderer.quad(position(uStart, vStart), Vector(0.0f, 0.0f, texture),
+                              position(uEnd, vStart), Vector(u, 0.0f, texture),
+                              position(uEnd, vEnd), Vector(u, v, texture),
+                              position(uStart, vEnd), Vector(0.0f, v, texture),
+                              material);
+            }
+        }
+    }
+
     Vector GL1Buffer::getVertexPosition(const Duel6::Vertex &vertex) const {
         Float32 y = vertex.y;
         if (vertex.getFlag() == Vertex::Flow) {
@@ -48,9 +48,14 @@ namespace Duel6 {
 
         void update(const FaceList &faceList) override;
 
+        void update(const FaceList &faceList, Size firstFace, Size faceCount) override;
+
         void render(const Material &material) override;
 
     private:
+        void renderTiled(const Vertex &v1, const Vertex &v2, const Vertex &v3, const Vertex &v4, Float32 texture,
+                         const Material &material);
+
         Vector getVertexPosition(const Vertex &vertex) const;
     };
 }
@@ -141,19 +141,19 @@ namespace Duel6 {
         glViewport(x, y, width, height);
     }
 
-    void GL1Renderer::enableWireframe(bool enable) {
+    void GL1Renderer::applyWireframe(bool enable) {
         glPolygonMode(GL_FRONT_AND_BACK, enable ? GL_LINE : GL_FILL);
     }
 
-    void GL1Renderer::enableDepthTest(bool enable) {
+    void GL1Renderer::applyDepthTest(bool enable) {
         enableOption(GL_DEPTH_TEST, enable);
     }
 
-    void GL1Renderer::enableDepthWrite(bool enable) {
+    void GL1Renderer::applyDepthWrite(bool enable) {
         glDepthMask(GLboolean(enable ? GL_TRUE : GL_FALSE));
     }
 
-    void GL1Renderer::setBlendFunc(BlendFunc func) {
+    void GL1Renderer::applyBlendFunc(BlendFunc func) {
         switch (func) {
             case BlendFunc::None:
                 glDisable(GL_BLEND);
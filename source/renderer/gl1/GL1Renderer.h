@@ -52,14 +52,6 @@ namespace Duel6 {
 
         void setViewport(Int32 x, Int32 y, Int32 width, Int32 height) override;
 
-        void enableWireframe(bool enable) override;
-
-        void enableDepthTest(bool enable) override;
-
-        void enableDepthWrite(bool enable) override;
-
-        void setBlendFunc(BlendFunc func) override;
-
         void setGlobalTime(Float32 time) override;
 
         Float32 getGlobalTime() const;
@@ -97,6 +89,15 @@ namespace Duel6 {
 
     private:
         void enableOption(GLenum option, bool enable);
+
+    protected:
+        void applyWireframe(bool enable) override;
+
+        void applyDepthTest(bool enable) override;
+
+        void applyDepthWrite(bool enable) override;
+
+        void applyBlendFunc(BlendFunc func) override;
     };
 }
 
@@ -42,9 +42,9 @@ namespace Duel6 {
     void GL1RendererTarget::apply(const Color &modulateColor) {
         callback();
 
-        glEnable(GL_BLEND);
+        renderer.setBlendFunc(BlendFunc::SrcColor);
         glBlendFunc(GL_ZERO, GL_SRC_COLOR);
         renderer.quadXY(Vector::ZERO, Vector(Float32(width), Float32(height), 5.0f), modulateColor);
-        glDisable(GL_BLEND);
+        renderer.setBlendFunc(BlendFunc::None);
     }
 }
@@ -29,22 +29,28 @@
 #include "../../Vertex.h"
 #include "../../FaceList.h"
 #include "GL4Buffer.h"
+#include "GL4Renderer.h"
 
 namespace Duel6 {
-    GL4Buffer::GL4Buffer(GL4Program &program, const FaceList &faceList)
-            : program(program), elements(6 * faceList.getFaces().size()) {
+    GL4Buffer::GL4Buffer(GL4Renderer &renderer, const FaceList &faceList)
+            : renderer(renderer), elements(6 * faceList.getFaces().size()) {
+        Size faces = faceList.getFaces().size();
+        Size capacity = 6 * faceList.getCapacity();
+        GLenum usage = capacity > elements ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW;
+
         std::vector<Vertex> vertexBuffer;
-        createFaceListVertexBuffer(faceList, vertexBuffer);
+        createFaceListVertexBuffer(faceList, 0, faces, vertexBuffer);
 
-        std::vector<Float32> textureIndexBuffer;
-        createFaceListTextureIndexBuffer(faceList, textureIndexBuffer);
+        std::vector<Float32> animationBuffer;
+        createFaceListAnimationBuffer(faceList, 0, faces, animationBuffer);
 
         glGenVertexArrays(1, &vao);
         glBindVertexArray(vao);
 
         glGenBuffers(1, &vertexVbo);
         glBindBuffer(GL_ARRAY_BUFFER, vertexVbo);
-        glBufferData(GL_ARRAY_BUFFER, vertexBuffer.size() * sizeof(Vertex), vertexBuffer.data(), GL_STATIC_DRAW);
+        glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(Vertex), nullptr, usage);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, vertexBuffer.size() * sizeof(Vertex), vertexBuffer.data());
         //glNamedBufferStorage(vertexVbo, vertexBuffer.size() * sizeof(Float32), vertexBuffer.data(), 0); // GL 4.5
 
         glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), nullptr);
@@ -54,13 +60,12 @@ namespace Duel6 {
         glVertexAttribIPointer(3, 1, GL_UNSIGNED_INT, sizeof(Vertex), (const GLvoid *) (5 * sizeof(Float32)));
         glEnableVertexAttribArray(3);
 
-        glGenBuffers(1, &textureIndexVbo);
-        glBindBuffer(GL_ARRAY_BUFFER, textureIndexVbo);
-        glBufferData(GL_ARRAY_BUFFER, textureIndexBuffer.size() * sizeof(Float32), textureIndexBuffer.data(),
-                     GL_STATIC_DRAW);
-        //glNamedBufferStorage(textureIndexVbo, textureIndexBuffer.size() * sizeof(Float32), textureIndexBuffer.data(), 0); // GL 4.5
+        glGenBuffers(1, &animationVbo);
+        glBindBuffer(GL_ARRAY_BUFFER, animationVbo);
+        glBufferData(GL_ARRAY_BUFFER, capacity * 3 * sizeof(Float32), nullptr, usage);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, animationBuffer.size() * sizeof(Float32), animationBuffer.data());
 
-        glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, 0, nullptr);
+        glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
         glEnableVertexAttribArray(2);
 
         glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -70,41 +75,50 @@ namespace Duel6 {
     GL4Buffer::~GL4Buffer() {
         glDeleteVertexArrays(1, &vao);
         glDeleteBuffers(1, &vertexVbo);
-        glDeleteBuffers(1, &textureIndexVbo);
+        glDeleteBuffers(1, &animationVbo);
     }
 
-    void GL4Buffer::update(const FaceList &faceList) {
-        std::vector<Float32> textureIndexBuffer;
-        createFaceListTextureIndexBuffer(faceList, textureIndexBuffer);
+    void GL4Buffer::update(const FaceList &) {
+        // Nothing changes per frame, the vertex shader picks the animation frame from the global time
+    }
 
-        glBindBuffer(GL_ARRAY_BUFFER, textureIndexVbo);
-        glBufferData(GL_ARRAY_BUFFER, textureIndexBuffer.size() * sizeof(Float32), textureIndexBuffer.data(),
-                     GL_STATIC_DRAW);
-        // glBufferSubData(GL_ARRAY_BUFFER, 0, elements * sizeof(Float32), textureIndexBuffer.data());
-        // glNamedBufferSubData(textureIndexVbo, 0, elements * sizeof(Float32), textureIndexBuffer.data()); // GL 4.5
+    void GL4Buffer::update(const FaceList &faceList, Size firstFace, Size faceCount) {
+        renderer.drawBatch();
+        elements = 6 * faceList.getFaces().size();
+        if (faceCount == 0) {
+            return;
+        }
+
+        std::vector<Vertex> vertexBuffer;
+        createFaceListVertexBuffer(faceList, firstFace, faceCount, vertexBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, vertexVbo);
+        glBufferSubData(GL_ARRAY_BUFFER, 6 * firstFace * sizeof(Vertex), vertexBuffer.size() * sizeof(Vertex),
+                        vertexBuffer.data());
+
+        std::vector<Float32> animationBuffer;
+        createFaceListAnimationBuffer(faceList, firstFace, faceCount, animationBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, animationVbo);
+        glBufferSubData(GL_ARRAY_BUFFER, 6 * 3 * firstFace * sizeof(Float32),
+                        animationBuffer.size() * sizeof(Float32), animationBuffer.data());
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
     }
 
     void GL4Buffer::render(const Material &material) {
+        renderer.drawBatch();
         glBindVertexArray(vao);
-        program.bind();
-
-        glBindTexture(GL_TEXTURE_2D_ARRAY, material.getTexture());
-        program.setUniform("alphaTest", material.isMasked() ? 1 : 0);
+        renderer.bindMaterial(material.getTexture(), material.isMasked());
 
         const Color &color = material.getColor();
-        Float32 colorData[4] = {color.getRed() / 255.0f, color.getGreen() / 255.0f, color.getBlue() / 255.0f,
-                                color.getAlpha() / 255.0f};
-        program.setUniform("color", colorData);
+        glVertexAttrib4f(4, color.getRed() / 255.0f, color.getGreen() / 255.0f, color.getBlue() / 255.0f,
+                         color.getAlpha() / 255.0f);
 
         glDrawArrays(GL_TRIANGLES, 0, elements);
     }
 
 
-    void GL4Buffer::createFaceListVertexBuffer(const FaceList &faceList, std::vector<Vertex> &vertexBuffer) {
-        const Vertex *vertex = faceList.getVertexes().data();
-        const auto &faces = faceList.getFaces();
-
-        const auto faceCount = faces.size();
+    void GL4Buffer::createFaceListVertexBuffer(const FaceList &faceList, Size firstFace, Size faceCount,
+                                               std::vector<Vertex> &vertexBuffer) {
+        const Vertex *vertex = faceList.getVertexes().data() + 4 * firstFace;
         vertexBuffer.reserve(faceCount * 6);
 
         for (Size i = 0; i < faceCount; i++, vertex += 4) {
@@ -122,19 +136,20 @@ namespace Duel6 {
         }
     }
 
-    void
-    GL4Buffer::createFaceListTextureIndexBuffer(const FaceList &faceList, std::vector<Float32> &textureIndexBuffer) {
+    void GL4Buffer::createFaceListAnimationBuffer(const FaceList &faceList, Size firstFace, Size faceCount,
+                                                  std::vector<Float32> &animationBuffer) {
         const auto &faces = faceList.getFaces();
-        textureIndexBuffer.reserve(faces.size() * 6);
-
-        for (const Face &face : faces) {
-            Float32 textureIndex = face.getCurrentTexture();
-            textureIndexBuffer.push_back(textureIndex);
-            textureIndexBuffer.push_back(textureIndex);
-            textureIndexBuffer.push_back(textureIndex);
-            textureIndexBuffer.push_back(textureIndex);
-            textureIndexBuffer.push_back(textureIndex);
-            textureIndexBuffer.push_back(textureIndex);
+        animationBuffer.reserve(faceCount * 6 * 3);
+
+        for (Size i = firstFace; i < firstFace + faceCount; i++) {
+            const Face &face = faces[i];
+            Float32 firstTexture = Float32(face.getFirstTexture());
+            Float32 frames = Float32(face.getAnimationFrames());
+            for (Size vertex = 0; vertex < 6; vertex++) {
+                animationBuffer.push_back(firstTexture);
+                animationBuffer.push_back(frames);
+                animationBuffer.push_back(faceList.getAnimationSpeed());
+            }
         }
     }
 }
\ No newline at end of file
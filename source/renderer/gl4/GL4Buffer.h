@@ -31,30 +31,36 @@
 #include "../../Vertex.h"
 #include "../RendererBuffer.h"
 #include "GL4Types.h"
-#include "GL4Program.h"
 
 namespace Duel6 {
+    class GL4Renderer;
+
     class GL4Buffer : public RendererBuffer {
     private:
-        GL4Program &program;
+        GL4Renderer &renderer;
         Uint32 vao;
         Uint32 vertexVbo;
-        Uint32 textureIndexVbo;
+        Uint32 animationVbo;
         Size elements;
 
     public:
-        explicit GL4Buffer(GL4Program &program, const FaceList &faceList);
+        GL4Buffer(GL4Renderer &renderer, const FaceList &faceList);
 
         ~GL4Buffer() override;
 
         void update(const FaceList &faceList) override;
 
+        void update(const FaceList &faceList, Size firstFace, Size faceCount) override;
+
         void render(const Material &material) override;
 
     private:
-        void createFaceListVertexBuffer(const FaceList &faceList, std::vector<Vertex> &vertexBuffer);
+        void createFaceListVertexBuffer(const FaceList &faceList, Size firstFace, Size faceCount,
+                                        std::vector<Vertex> &vertexBuffer);
 
-        void createFaceListTextureIndexBuffer(const FaceList &faceList, std::vector<Float32> &textureIndexBuffer);
+        // First texture, number of frames and seconds per frame of every vertex
+        void createFaceListAnimationBuffer(const FaceList &faceList, Size firstFace, Size faceCount,
+                                           std::vector<Float32> &animationBuffer);
     };
 }
 
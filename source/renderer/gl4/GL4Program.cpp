@@ -31,6 +31,23 @@
 #include "GL4Program.h"
 
 namespace Duel6 {
+    GLuint GL4Program::boundProgram = 0;
+
+    template<>
+    void GL4Uniform<Int32>::set(const Int32 &value) const {
+        glProgramUniform1i(program, location, value);
+    }
+
+    template<>
+    void GL4Uniform<Float32>::set(const Float32 &value) const {
+        glProgramUniform1f(program, location, value);
+    }
+
+    template<>
+    void GL4Uniform<Matrix>::set(const Matrix &value) const {
+        glProgramUniformMatrix4fv(program, location, 1, GL_FALSE, value.getStorage());
+    }
+
     GL4Program::GL4Program(const GL4Shader &vertexShader, const GL4Shader &fragmentShader)
             : vertexShader(vertexShader), fragmentShader(fragmentShader) {
         id = glCreateProgram();
@@ -58,33 +75,26 @@ namespace Duel6 {
 
     GL4Program::~GL4Program() {
         if (id != 0) {
+            if (boundProgram == id) {
+                boundProgram = 0;
+            }
             glDeleteProgram(id);
             id = 0;
         }
     }
 
     void GL4Program::bind() {
-        glUseProgram(id);
-    }
-
-    GLint GL4Program::uniformLocation(const GLchar *name) {
-        return glGetUniformLocation(id, name);
-    }
-
-    void GL4Program::setUniform(const GLchar *name, Int32 value) {
-        glProgramUniform1i(id, uniformLocation(name), value);
-    }
-
-    void GL4Program::setUniform(const GLchar *name, Float32 value) {
-        glProgramUniform1f(id, uniformLocation(name), value);
-    }
-
-    void GL4Program::setUniform(const GLchar *name, Float32 value[4]) {
-        glProgramUniform4fv(id, uniformLocation(name), 1, value);
+        if (boundProgram != id) {
+            glUseProgram(id);
+            boundProgram = id;
+        }
     }
 
-    void GL4Program::setUniform(const GLchar *name, const Matrix &value) {
-        glProgramUniformMatrix4fv(id, uniformLocation(name), 1, GL_FALSE, value.getStorage());
+    void GL4Program::bindUniformBlock(const GLchar *name, GLuint binding) {
+        GLuint index = glGetUniformBlockIndex(id, name);
+        if (index != GL_INVALID_INDEX) {
+            glUniformBlockBinding(id, index, binding);
+        }
     }
 
     GLuint GL4Program::getId() const {
@@ -34,8 +34,33 @@
 #include "GL4Shader.h"
 
 namespace Duel6 {
+    /** Location of a uniform variable, resolved once after the program is linked */
+    template<class T>
+    class GL4Uniform {
+    private:
+        GLuint program;
+        GLint location;
+
+    public:
+        GL4Uniform(GLuint program, GLint location)
+                : program(program), location(location) {}
+
+        void set(const T &value) const;
+    };
+
+    template<>
+    void GL4Uniform<Int32>::set(const Int32 &value) const;
+
+    template<>
+    void GL4Uniform<Float32>::set(const Float32 &value) const;
+
+    template<>
+    void GL4Uniform<Matrix>::set(const Matrix &value) const;
+
     class GL4Program {
     private:
+        static GLuint boundProgram;
+
         const GL4Shader &vertexShader;
         const GL4Shader &fragmentShader;
         GLuint id;
@@ -44,13 +69,16 @@ namespace Duel6 {
         GL4Program(const GL4Shader &vertexShader, const GL4Shader &fragmentShader);
         ~GL4Program();
 
+        /** Does nothing when the program is already in use */
         void bind();
-        GLint uniformLocation(const GLchar *name);
 
-        void setUniform(const GLchar *name, Int32 value);
-        void setUniform(const GLchar *name, Float32 value);
-        void setUniform(const GLchar *name, Float32 value[4]);
-        void setUniform(const GLchar *name, const Matrix &value);
+        template<class T>
+        GL4Uniform<T> getUniform(const GLchar *name) const {
+            return GL4Uniform<T>(id, glGetUniformLocation(id, name));
+        }
+
+        /** Connects a uniform block of the program to a buffer binding point */
+        void bindUniformBlock(const GLchar *name, GLuint binding);
 
         GLuint getId() const;
 
@@ -59,4 +87,4 @@ namespace Duel6 {
     };
 }
 
-#endif
\ No newline at end of file
+#endif
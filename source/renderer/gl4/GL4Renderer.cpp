@@ -25,23 +25,21 @@
 * OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <algorithm>
 #include "../../FaceList.h"
 #include "../../Exception.h"
 #include "GL4Renderer.h"
 #include "GL4RendererTarget.h"
 
 namespace Duel6 {
-    struct ColorVertex {
-        Vector xyz;
-    };
-    static ColorVertex colorPoints[4];
-
-    struct MaterialVertex {
-        Vector xyz; // Position
-        Vector str; // Texture coordinates
-        Uint32 flags = 0;
-    };
-    static MaterialVertex materialPoints[4];
+    namespace {
+        bool isSameMatrix(const Matrix &a, const Matrix &b) {
+            return std::equal(a.getStorage(), a.getStorage() + 16, b.getStorage());
+        }
+
+        // Vertices available to a single frame, larger frames wait for the GPU in the middle
+        const Size STREAM_VERTICES = 65536;
+    }
 
     GL4Renderer::GL4Renderer()
             : RendererBase(),
@@ -50,43 +48,54 @@ namespace Duel6 {
               materialVertexShader(GL_VERTEX_SHADER, "shaders/gl4/materialVertex.glsl"),
               materialFragmentShader(GL_FRAGMENT_SHADER, "shaders/gl4/materialFragment.glsl"),
               colorProgram(colorVertexShader, colorFragmentShader),
-              materialProgram(materialVertexShader, materialFragmentShader) {
+              materialProgram(materialVertexShader, materialFragmentShader),
+              colorModelMatrix(colorProgram.getUniform<Matrix>("model")),
+              materialModelMatrix(materialProgram.getUniform<Matrix>("model")),
+              alphaTest(materialProgram.getUniform<Int32>("alphaTest")),
+              globalTime(materialProgram.getUniform<Float32>("globalTime")),
+              matricesChanged(true),
+              modelMatrixChanged(true),
+              streamBuffer(STREAM_VERTICES * sizeof(StreamVertex)),
+              batch{nullptr, GL_TRIANGLES, 1.0f, 0, false},
+              batchFirst(0),
+              batchVertices(0) {
         enableOption(GL_CULL_FACE, true);
         glFrontFace(GL_CW);
         glCullFace(GL_BACK);
         glActiveTexture(GL_TEXTURE0);
 
-        glGenVertexArrays(1, &colorVao);
-        glBindVertexArray(colorVao);
-
-        glGenBuffers(1, &colorVbo);
-        glBindBuffer(GL_ARRAY_BUFFER, colorVbo);
-        glBufferData(GL_ARRAY_BUFFER, 4 * sizeof(ColorVertex), colorPoints, GL_STREAM_DRAW);
-        //glNamedBufferStorage(colorVbo, 4 * sizeof(ColorVertex), colorPoints, GL_DYNAMIC_STORAGE_BIT);  // GL 4.5
+        glGenBuffers(1, &matricesUbo);
+        glBindBuffer(GL_UNIFORM_BUFFER, matricesUbo);
+        glBufferData(GL_UNIFORM_BUFFER, 2 * 16 * sizeof(Float32), nullptr, GL_DYNAMIC_DRAW);
+        glBindBufferBase(GL_UNIFORM_BUFFER, 0, matricesUbo);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        colorProgram.bindUniformBlock("Matrices", 0);
+        materialProgram.bindUniformBlock("Matrices", 0);
 
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
-        glEnableVertexAttribArray(0);
-
-        glGenVertexArrays(1, &materialVao);
-        glBindVertexArray(materialVao);
+        glGenVertexArrays(1, &streamVao);
+        glBindVertexArray(streamVao);
+        glBindBuffer(GL_ARRAY_BUFFER, streamBuffer.getId());
 
-        glGenBuffers(1, &materialVbo);
-        glBindBuffer(GL_ARRAY_BUFFER, materialVbo);
-        glBufferData(GL_ARRAY_BUFFER, 4 * sizeof(MaterialVertex), materialPoints, GL_STREAM_DRAW);
-        //glNamedBufferStorage(materialVbo, 4 * sizeof(MaterialVertex), materialPoints, GL_DYNAMIC_STORAGE_BIT);  // GL 4.5
-
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(MaterialVertex), nullptr);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(StreamVertex), nullptr);
         glEnableVertexAttribArray(0);
-        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(MaterialVertex), (const GLvoid *) (3 * sizeof(Float32)));
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(StreamVertex), (const GLvoid *) (3 * sizeof(Float32)));
         glEnableVertexAttribArray(1);
-        glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(MaterialVertex), (const GLvoid *) (5 * sizeof(Float32)));
+        glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(StreamVertex), (const GLvoid *) (5 * sizeof(Float32)));
         glEnableVertexAttribArray(2);
-        glVertexAttribIPointer(3, 1, GL_UNSIGNED_INT, sizeof(MaterialVertex), (const GLvoid *) (6 * sizeof(Float32)));
+        glVertexAttribIPointer(3, 1, GL_UNSIGNED_INT, sizeof(StreamVertex), (const GLvoid *) (6 * sizeof(Float32)));
         glEnableVertexAttribArray(3);
+        glVertexAttribPointer(4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(StreamVertex), (const GLvoid *) (7 * sizeof(Float32)));
+        glEnableVertexAttribArray(4);
 
+        glBindVertexArray(0);
         glBindBuffer(GL_ARRAY_BUFFER, 0);
     }
 
+    GL4Renderer::~GL4Renderer() {
+        glDeleteVertexArrays(1, &streamVao);
+        glDeleteBuffers(1, &matricesUbo);
+    }
+
     Renderer::Info GL4Renderer::getInfo() {
         Info info;
         info.vendor = (const char *) glGetString(GL_VENDOR);
@@ -127,11 +136,13 @@ namespace Duel6 {
     }
 
     void GL4Renderer::freeTexture(Texture textureId) {
+        drawBatch();
         GLuint id = textureId;
         glDeleteTextures(1, &id);
     }
 
     Image GL4Renderer::makeScreenshot() {
+        drawBatch();
         GLint dimensions[4];
         glGetIntegerv(GL_VIEWPORT, dimensions);
 
@@ -145,22 +156,27 @@ namespace Duel6 {
     }
 
     void GL4Renderer::setViewport(Int32 x, Int32 y, Int32 width, Int32 height) {
+        drawBatch();
         glViewport(x, y, width, height);
     }
 
-    void GL4Renderer::enableWireframe(bool enable) {
+    void GL4Renderer::applyWireframe(bool enable) {
+        drawBatch();
         glPolygonMode(GL_FRONT_AND_BACK, enable ? GL_LINE : GL_FILL);
     }
 
-    void GL4Renderer::enableDepthTest(bool enable) {
+    void GL4Renderer::applyDepthTest(bool enable) {
+        drawBatch();
         enableOption(GL_DEPTH_TEST, enable);
     }
 
-    void GL4Renderer::enableDepthWrite(bool enable) {
+    void GL4Renderer::applyDepthWrite(bool enable) {
+        drawBatch();
         glDepthMask(GLboolean(enable ? GL_TRUE : GL_FALSE));
     }
 
-    void GL4Renderer::setBlendFunc(BlendFunc func) {
+    void GL4Renderer::applyBlendFunc(BlendFunc func) {
+        drawBatch();
         switch (func) {
             case BlendFunc::None:
                 glDisable(GL_BLEND);
@@ -177,120 +193,66 @@ namespace Duel6 {
     }
 
     void GL4Renderer::setGlobalTime(Float32 time) {
+        drawBatch();
         materialProgram.bind(); // Required for INTEL
-        materialProgram.setUniform("globalTime", time);
+        globalTime.set(time);
     }
 
     void GL4Renderer::clearBuffers() {
+        drawBatch();
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     }
 
     void GL4Renderer::setProjectionMatrix(const Matrix &m) {
-        RendererBase::setProjectionMatrix(m);
-        updateMvpUniform();
+        if (!isSameMatrix(m, projectionMatrix)) {
+            drawBatch();
+            RendererBase::setProjectionMatrix(m);
+            matricesChanged = true;
+        }
     }
 
     void GL4Renderer::setViewMatrix(const Matrix &m) {
-        RendererBase::setViewMatrix(m);
-        updateMvpUniform();
+        if (!isSameMatrix(m, viewMatrix)) {
+            drawBatch();
+            RendererBase::setViewMatrix(m);
+            matricesChanged = true;
+        }
     }
 
     void GL4Renderer::setModelMatrix(const Matrix &m) {
-        RendererBase::setModelMatrix(m);
-        updateMvpUniform();
+        if (!isSameMatrix(m, modelMatrix)) {
+            drawBatch();
+            RendererBase::setModelMatrix(m);
+            modelMatrixChanged = true;
+        }
     }
 
     void GL4Renderer::point(const Vector &position, Float32 size, const Color &color) {
-        glBindVertexArray(colorVao);
-        colorProgram.bind();
-
-        colorPoints[0].xyz = position;
-        updateColorBuffer(1);
-
-        Float32 colorData[4] = {color.getRed() / 255.0f, color.getGreen() / 255.0f, color.getBlue() / 255.0f,
-                                color.getAlpha() / 255.0f};
-        colorProgram.setUniform("color", colorData);
-
-        glPointSize(size);
-        glDrawArrays(GL_POINTS, 0, 1);
-        glPointSize(1);
+        addColorVertices(GL_POINTS, size, color, &position, 1);
     }
 
     void GL4Renderer::line(const Vector &from, const Vector &to, Float32 width, const Color &color) {
-        glBindVertexArray(colorVao);
-        colorProgram.bind();
-
-        colorPoints[0].xyz = from;
-        colorPoints[1].xyz = to;
-        updateColorBuffer(2);
-
-        Float32 colorData[4] = {color.getRed() / 255.0f, color.getGreen() / 255.0f, color.getBlue() / 255.0f,
-                                color.getAlpha() / 255.0f};
-        colorProgram.setUniform("color", colorData);
-
-        glLineWidth(width);
-        glDrawArrays(GL_LINES, 0, 2);
-        glLineWidth(1.0f);
+        Vector points[2] = {from, to};
+        addColorVertices(GL_LINES, width, color, points, 2);
     }
 
     void GL4Renderer::triangle(const Vector &p1, const Vector &p2, const Vector &p3, const Color &color) {
-        glBindVertexArray(colorVao);
-        colorProgram.bind();
-
-        colorPoints[0].xyz = p1;
-        colorPoints[1].xyz = p2;
-        colorPoints[2].xyz = p3;
-        updateColorBuffer(3);
-
-        Float32 colorData[4] = {color.getRed() / 255.0f, color.getGreen() / 255.0f, color.getBlue() / 255.0f,
-                                color.getAlpha() / 255.0f};
-        colorProgram.setUniform("color", colorData);
-
-        glDrawArrays(GL_TRIANGLES, 0, 3);
+        Vector points[3] = {p1, p2, p3};
+        addColorVertices(GL_TRIANGLES, 1.0f, color, points, 3);
     }
 
     void GL4Renderer::triangle(const Vector &p1, const Vector &t1,
                                const Vector &p2, const Vector &t2,
                                const Vector &p3, const Vector &t3,
                                const Material &material) {
-        glBindVertexArray(materialVao);
-        materialProgram.bind();
-
-        glBindTexture(GL_TEXTURE_2D_ARRAY, material.getTexture());
-
-        materialPoints[0].xyz = p1;
-        materialPoints[0].str = t1;
-        materialPoints[1].xyz = p2;
-        materialPoints[1].str = t2;
-        materialPoints[2].xyz = p3;
-        materialPoints[2].str = t3;
-        updateMaterialBuffer(3);
-
-        materialProgram.setUniform("alphaTest", material.isMasked() ? 1 : 0);
-
-        const Color &color = material.getColor();
-        Float32 colorData[4] = {color.getRed() / 255.0f, color.getGreen() / 255.0f, color.getBlue() / 255.0f,
-                                color.getAlpha() / 255.0f};
-        materialProgram.setUniform("modulateColor", colorData);
-
-        glDrawArrays(GL_TRIANGLES, 0, 3);
+        Vector points[3] = {p1, p2, p3};
+        Vector textureCoordinates[3] = {t1, t2, t3};
+        addMaterialVertices(points, textureCoordinates, 3, material);
     }
 
     void GL4Renderer::quad(const Vector &p1, const Vector &p2, const Vector &p3, const Vector &p4, const Color &color) {
-        glBindVertexArray(colorVao);
-        colorProgram.bind();
-
-        colorPoints[0].xyz = p1;
-        colorPoints[1].xyz = p2;
-        colorPoints[2].xyz = p3;
-        colorPoints[3].xyz = p4;
-        updateColorBuffer(4);
-
-        Float32 colorData[4] = {color.getRed() / 255.0f, color.getGreen() / 255.0f, color.getBlue() / 255.0f,
-                                color.getAlpha() / 255.0f};
-        colorProgram.setUniform("color", colorData);
-
-        glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+        Vector points[6] = {p1, p2, p3, p1, p3, p4};
+        addColorVertices(GL_TRIANGLES, 1.0f, color, points, 6);
     }
 
     void GL4Renderer::quad(const Vector &p1, const Vector &t1,
@@ -298,37 +260,61 @@ namespace Duel6 {
                            const Vector &p3, const Vector &t3,
                            const Vector &p4, const Vector &t4,
                            const Material &material) {
-        glBindVertexArray(materialVao);
-        materialProgram.bind();
+        Vector points[6] = {p1, p2, p3, p1, p3, p4};
+        Vector textureCoordinates[6] = {t1, t2, t3, t1, t3, t4};
+        addMaterialVertices(points, textureCoordinates, 6, material);
+    }
 
-        glBindTexture(GL_TEXTURE_2D_ARRAY, material.getTexture());
+    std::unique_ptr<RendererBuffer> GL4Renderer::makeBuffer(const FaceList &faceList) {
+        return std::make_unique<GL4Buffer>(*this, faceList);
+    }
 
-        materialPoints[0].xyz = p1;
-        materialPoints[0].str = t1;
-        materialPoints[1].xyz = p2;
-        materialPoints[1].str = t2;
-        materialPoints[2].xyz = p3;
-        materialPoints[2].str = t3;
-        materialPoints[3].xyz = p4;
-        materialPoints[3].str = t4;
-        updateMaterialBuffer(4);
+    std::unique_ptr<RendererTarget> GL4Renderer::makeTarget(ScreenParameters screenParameters) {
+        return std::make_unique<GL4RendererTarget>(*this, screenParameters);
+    }
 
-        materialProgram.setUniform("alphaTest", material.isMasked() ? 1 : 0);
+    void GL4Renderer::flush() {
+        drawBatch();
+        streamBuffer.nextRegion();
+    }
 
-        const Color &color = material.getColor();
-        Float32 colorData[4] = {color.getRed() / 255.0f, color.getGreen() / 255.0f, color.getBlue() / 255.0f,
-                                color.getAlpha() / 255.0f};
-        materialProgram.setUniform("modulateColor", colorData);
+    void GL4Renderer::drawBatch() {
+        if (batchVertices == 0) {
+            return;
+        }
 
-        glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
-    }
+        streamBuffer.upload();
+        glBindVertexArray(streamVao);
 
-    std::unique_ptr<RendererBuffer> GL4Renderer::makeBuffer(const FaceList &faceList) {
-        return std::make_unique<GL4Buffer>(materialProgram, faceList);
+        if (batch.program == &materialProgram) {
+            bindMaterial(batch.texture, batch.alphaTest);
+        } else {
+            updateMatrices();
+            colorProgram.bind();
+        }
+
+        if (batch.mode == GL_POINTS) {
+            glPointSize(batch.size);
+        } else if (batch.mode == GL_LINES) {
+            glLineWidth(batch.size);
+        }
+
+        glDrawArrays(batch.mode, batchFirst, batchVertices);
+
+        if (batch.mode == GL_POINTS) {
+            glPointSize(1);
+        } else if (batch.mode == GL_LINES) {
+            glLineWidth(1.0f);
+        }
+
+        batchVertices = 0;
     }
 
-    std::unique_ptr<RendererTarget> GL4Renderer::makeTarget(ScreenParameters screenParameters) {
-        return std::make_unique<GL4RendererTarget>(*this, screenParameters);
+    void GL4Renderer::bindMaterial(Texture texture, bool masked) {
+        updateMatrices();
+        materialProgram.bind();
+        glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+        alphaTest.set(masked ? 1 : 0);
     }
 
     void GL4Renderer::enableOption(GLenum option, bool enable) {
@@ -339,26 +325,56 @@ namespace Duel6 {
         }
     }
 
-    void GL4Renderer::updateColorBuffer(Int32 vertexCount) {
-        glBindBuffer(GL_ARRAY_BUFFER, colorVbo);
-        glBufferData(GL_ARRAY_BUFFER, 4 * sizeof(ColorVertex), colorPoints, GL_STREAM_DRAW);
-        // glBufferSubData(GL_ARRAY_BUFFER, 0, vertexCount * sizeof(ColorVertex), colorPoints);
-        // glNamedBufferSubData(triangleVbo, 0, vertexCount * sizeof(VertexData), points); // GL 4.5
+    GL4Renderer::StreamVertex *GL4Renderer::addVertices(const Batch &batch, Size count) {
+        Size bytes = count * sizeof(StreamVertex);
+        if (batchVertices > 0 && (!(batch == this->batch) || !streamBuffer.hasSpace(bytes))) {
+            drawBatch();
+        }
+        if (!streamBuffer.hasSpace(bytes)) {
+            streamBuffer.nextRegion();
+        }
+
+        if (batchVertices == 0) {
+            this->batch = batch;
+            batchFirst = GLint(streamBuffer.getOffset() / sizeof(StreamVertex));
+        }
+
+        batchVertices += GLsizei(count);
+        return static_cast<StreamVertex *>(streamBuffer.write(bytes));
+    }
+
+    void GL4Renderer::addColorVertices(GLenum mode, Float32 size, const Color &color, const Vector *points, Size count) {
+        StreamVertex *vertices = addVertices({&colorProgram, mode, size, 0, false}, count);
+        for (Size i = 0; i < count; i++) {
+            vertices[i] = {points[i], Vector(), 0, color};
+        }
     }
 
-    void GL4Renderer::updateMaterialBuffer(Int32 vertexCount) {
-        glBindBuffer(GL_ARRAY_BUFFER, materialVbo);
-        glBufferData(GL_ARRAY_BUFFER, 4 * sizeof(MaterialVertex), materialPoints, GL_STREAM_DRAW);
-        // glBufferSubData(GL_ARRAY_BUFFER, 0, vertexCount * sizeof(MaterialVertex), materialPoints);
-        // glNamedBufferSubData(triangleVbo, 0, vertexCount * sizeof(VertexData), points); // GL 4.5
+    void GL4Renderer::addMaterialVertices(const Vector *points, const Vector *textureCoordinates, Size count,
+                                          const Material &material) {
+        StreamVertex *vertices = addVertices({&materialProgram, GL_TRIANGLES, 1.0f, material.getTexture(), material.isMasked()}, count);
+        for (Size i = 0; i < count; i++) {
+            vertices[i] = {points[i], textureCoordinates[i], 0, material.getColor()};
+        }
     }
 
-    void GL4Renderer::updateMvpUniform() {
-        mvpMatrix = projectionMatrix * viewMatrix * modelMatrix;
+    void GL4Renderer::updateMatrices() {
+        if (matricesChanged) {
+            Float32 data[32];
+            std::copy(projectionMatrix.getStorage(), projectionMatrix.getStorage() + 16, data);
+            std::copy(viewMatrix.getStorage(), viewMatrix.getStorage() + 16, data + 16);
+            glBindBuffer(GL_UNIFORM_BUFFER, matricesUbo);
+            glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(data), data);
+            glBindBuffer(GL_UNIFORM_BUFFER, 0);
+            matricesChanged = false;
+        }
 
-        colorProgram.bind(); // Required for INTEL
-        colorProgram.setUniform("mvp", mvpMatrix);
-        materialProgram.bind(); // Required for INTEL
-        materialProgram.setUniform("mvp", mvpMatrix);
+        if (modelMatrixChanged) {
+            colorProgram.bind(); // Required for INTEL
+            colorModelMatrix.set(modelMatrix);
+            materialProgram.bind(); // Required for INTEL
+            materialModelMatrix.set(modelMatrix);
+            modelMatrixChanged = false;
+        }
     }
 }
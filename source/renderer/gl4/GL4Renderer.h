@@ -33,16 +33,35 @@
 #include "GL4Program.h"
 #include "GL4Shader.h"
 #include "GL4Buffer.h"
+#include "GL4StreamBuffer.h"
 
 namespace Duel6 {
     class GL4Renderer
             : public RendererBase {
     private:
-        GLuint colorVao;
-        GLuint colorVbo;
-        GLuint materialVbo;
-        GLuint materialVao;
+        // Colored and textured primitives share the vertex format, the color program ignores texture coordinates
+        struct StreamVertex {
+            Vector xyz; // Position
+            Vector str; // Texture coordinates
+            Uint32 flags;
+            Color color;
+        };
+
+        // Consecutive primitives with equal batch state are drawn with a single call
+        struct Batch {
+            GL4Program *program;
+            GLenum mode;
+            Float32 size;   // Point size or line width
+            Texture texture;
+            bool alphaTest;
+
+            bool operator==(const Batch &batch) const {
+                return program == batch.program && mode == batch.mode && size == batch.size &&
+                       texture == batch.texture && alphaTest == batch.alphaTest;
+            }
+        };
 
+    private:
         GL4Shader colorVertexShader;
         GL4Shader colorFragmentShader;
         GL4Shader materialVertexShader;
@@ -50,10 +69,27 @@ namespace Duel6 {
 
         GL4Program colorProgram;
         GL4Program materialProgram;
+        GL4Uniform<Matrix> colorModelMatrix;
+        GL4Uniform<Matrix> materialModelMatrix;
+        GL4Uniform<Int32> alphaTest;
+        GL4Uniform<Float32> globalTime;
+
+        // Projection and view matrices shared by all programs
+        GLuint matricesUbo;
+        bool matricesChanged;
+        bool modelMatrixChanged;
+
+        GL4StreamBuffer streamBuffer;
+        GLuint streamVao;
+        Batch batch;
+        GLint batchFirst;
+        GLsizei batchVertices;
 
     public:
         GL4Renderer();
 
+        ~GL4Renderer() override;
+
         Info getInfo() override;
 
         Extensions getExtensions() override;
@@ -66,14 +102,6 @@ namespace Duel6 {
 
         void setViewport(Int32 x, Int32 y, Int32 width, Int32 height) override;
 
-        void enableWireframe(bool enable) override;
-
-        void enableDepthTest(bool enable) override;
-
-        void enableDepthWrite(bool enable) override;
-
-        void setBlendFunc(BlendFunc func) override;
-
         void setGlobalTime(Float32 time) override;
 
         void clearBuffers() override;
@@ -107,14 +135,34 @@ namespace Duel6 {
 
         std::unique_ptr<RendererTarget> makeTarget(ScreenParameters screenParameters) override;
 
+        void flush() override;
+
+        /** Draws the batched primitives, must precede every draw call and state change outside the renderer */
+        void drawBatch();
+
+        /** Binds the material program with up-to-date matrices for a draw call outside the renderer */
+        void bindMaterial(Texture texture, bool masked);
+
     private:
         void enableOption(GLenum option, bool enable);
 
-        void updateColorBuffer(Int32 vertexCount);
+        StreamVertex *addVertices(const Batch &batch, Size count);
+
+        void addColorVertices(GLenum mode, Float32 size, const Color &color, const Vector *points, Size count);
+
+        void addMaterialVertices(const Vector *points, const Vector *textureCoordinates, Size count,
+                                 const Material &material);
+
+        void updateMatrices();
+
+    protected:
+        void applyWireframe(bool enable) override;
+
+        void applyDepthTest(bool enable) override;
 
-        void updateMaterialBuffer(Int32 vertexCount);
+        void applyDepthWrite(bool enable) override;
 
-        void updateMvpUniform();
+        void applyBlendFunc(BlendFunc func) override;
     };
 }
 
@@ -78,9 +78,11 @@ namespace Duel6 {
     }
 
     void GL4RendererTarget::record(RenderCallback renderCallback) {
+        renderer.drawBatch();
         glBindFramebuffer(GL_FRAMEBUFFER, fbo);
         renderer.clearBuffers();
         renderCallback();
+        renderer.drawBatch();
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
     }
 
@@ -94,6 +96,7 @@ namespace Duel6 {
     }
 
     void GL4RendererTarget::blit() {
+        renderer.drawBatch();
         glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo);
         glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
         glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT,
@@ -102,6 +105,7 @@ namespace Duel6 {
     }
 
     void GL4RendererTarget::blitDepth() {
+        renderer.drawBatch();
         glBindFramebuffer(GL_READ_FRAMEBUFFER, fbo);
         glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
         glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_DEPTH_BUFFER_BIT, GL_NEAREST);
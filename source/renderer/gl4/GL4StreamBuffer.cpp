@@ -0,0 +1,97 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "GL4StreamBuffer.h"
+
+namespace Duel6 {
+    GL4StreamBuffer::GL4StreamBuffer(Size regionSize)
+            : regionSize(regionSize), region(0), used(0), uploaded(0), mapped(nullptr), fences() {
+        GLsizeiptr size = REGIONS * regionSize;
+        persistent = GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage;
+
+        glGenBuffers(1, &id);
+        glBindBuffer(GL_ARRAY_BUFFER, id);
+        if (persistent) {
+            GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+            mapped = (Uint8 *) glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+        } else {
+            glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_STREAM_DRAW);
+            staging.resize(regionSize);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    GL4StreamBuffer::~GL4StreamBuffer() {
+        for (GLsync fence : fences) {
+            if (fence != nullptr) {
+                glDeleteSync(fence);
+            }
+        }
+        if (persistent) {
+            glBindBuffer(GL_ARRAY_BUFFER, id);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+        glDeleteBuffers(1, &id);
+    }
+
+    void *GL4StreamBuffer::write(Size bytes) {
+        Uint8 *data = persistent ? mapped + region * regionSize + used : staging.data() + used;
+        used += bytes;
+        return data;
+    }
+
+    void GL4StreamBuffer::upload() {
+        if (!persistent && uploaded < used) {
+            glBindBuffer(GL_ARRAY_BUFFER, id);
+            glBufferSubData(GL_ARRAY_BUFFER, region * regionSize + uploaded, used - uploaded, &staging[uploaded]);
+        }
+        uploaded = used;
+    }
+
+    void GL4StreamBuffer::nextRegion() {
+        if (used == 0) {
+            return;
+        }
+
+        fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        region = (region + 1) % REGIONS;
+        used = 0;
+        uploaded = 0;
+
+        GLsync fence = fences[region];
+        if (fence != nullptr) {
+            GLenum result;
+            do {
+                result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+            } while (result == GL_TIMEOUT_EXPIRED);
+            glDeleteSync(fence);
+            fences[region] = nullptr;
+        }
+    }
+}
@@ -0,0 +1,93 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef DUEL6_RENDERER_GL4_GL4STREAMBUFFER_H
+#define DUEL6_RENDERER_GL4_GL4STREAMBUFFER_H
+
+#include <vector>
+#include "../../Type.h"
+#include "GL4Types.h"
+
+namespace Duel6 {
+    /**
+     * Vertex buffer for data written once and drawn once. The buffer is split into three regions used in turns,
+     * a fence keeps the CPU from overwriting a region the GPU is still reading. With GL_ARB_buffer_storage
+     * the buffer stays mapped and vertices are written directly into it, otherwise they are collected in memory
+     * and uploaded before drawing.
+     */
+    class GL4StreamBuffer {
+    private:
+        static const Size REGIONS = 3;
+
+        GLuint id;
+        Size regionSize;
+        Size region;
+        Size used;
+        Size uploaded;
+        bool persistent;
+        Uint8 *mapped;
+        std::vector<Uint8> staging;
+        GLsync fences[REGIONS];
+
+    public:
+        explicit GL4StreamBuffer(Size regionSize);
+
+        ~GL4StreamBuffer();
+
+        GL4StreamBuffer(const GL4StreamBuffer &) = delete;
+
+        GL4StreamBuffer &operator=(const GL4StreamBuffer &) = delete;
+
+        GLuint getId() const {
+            return id;
+        }
+
+        bool isPersistent() const {
+            return persistent;
+        }
+
+        bool hasSpace(Size bytes) const {
+            return used + bytes <= regionSize;
+        }
+
+        /** Offset from the start of the buffer where the next write goes */
+        Size getOffset() const {
+            return region * regionSize + used;
+        }
+
+        /** The caller has to check for space first */
+        void *write(Size bytes);
+
+        /** Makes everything written so far available to draw calls */
+        void upload();
+
+        /** Continues in the next region, waits until the GPU has finished reading it */
+        void nextRegion();
+    };
+}
+
+#endif
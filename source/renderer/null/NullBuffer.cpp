@@ -0,0 +1,90 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstring>
+#include "../../FaceList.h"
+#include "NullBuffer.h"
+#include "NullRenderer.h"
+
+namespace Duel6 {
+    NullBuffer::NullBuffer(NullRenderer &renderer, const FaceList &faceList)
+            : renderer(renderer), faceList(faceList), vertices(faceList.getVertexes().size()) {
+        renderer.recordBufferUpload(vertices);
+        copyFaces(0, faceList.getFaces().size());
+    }
+
+    void NullBuffer::update(const FaceList &faceList) {
+        vertices = faceList.getVertexes().size();
+        renderer.recordBufferUpload(vertices);
+    }
+
+    void NullBuffer::update(const FaceList &faceList, Size firstFace, Size faceCount) {
+        vertices = faceList.getVertexes().size();
+        renderer.recordBufferUpload(4 * faceCount);
+        copyFaces(firstFace, faceCount);
+    }
+
+    void NullBuffer::render(const Material &material) {
+        if (renderer.isVerifyingBuffers()) {
+            Size staleFaces = countStaleFaces();
+            if (staleFaces > 0) {
+                renderer.recordStaleFaces(staleFaces);
+            }
+        }
+        renderer.recordBufferDraw(vertices, material);
+    }
+
+    void NullBuffer::copyFaces(Size firstFace, Size faceCount) {
+        if (!renderer.isVerifyingBuffers()) {
+            return;
+        }
+
+        // The full update only advances animations, GPU renderers keep the buffer as it is
+        Size end = firstFace + faceCount;
+        uploadedVertexes.resize(std::max(uploadedVertexes.size(), 4 * end), Vertex(0, 0, 0, 0));
+        uploadedTextures.resize(std::max(uploadedTextures.size(), end));
+        std::copy_n(faceList.getVertexes().begin() + 4 * firstFace, 4 * faceCount,
+                    uploadedVertexes.begin() + 4 * firstFace);
+        for (Size i = firstFace; i < end; i++) {
+            const Face &face = faceList.getFaces()[i];
+            uploadedTextures[i] = {face.getFirstTexture(), face.getAnimationFrames()};
+        }
+    }
+
+    Size NullBuffer::countStaleFaces() const {
+        const std::vector<Face> &faces = faceList.getFaces();
+        Size staleFaces = 0;
+        for (Size i = 0; i < faces.size(); i++) {
+            bool stale = i >= uploadedTextures.size() ||
+                         uploadedTextures[i].first != faces[i].getFirstTexture() ||
+                         uploadedTextures[i].second != faces[i].getAnimationFrames() ||
+                         std::memcmp(&uploadedVertexes[4 * i], &faceList.getVertexes()[4 * i], 4 * sizeof(Vertex)) != 0;
+            staleFaces += Size(stale);
+        }
+        return staleFaces;
+    }
+}
@@ -0,0 +1,65 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef DUEL6_RENDERER_NULL_NULLBUFFER_H
+#define DUEL6_RENDERER_NULL_NULLBUFFER_H
+
+#include <utility>
+#include <vector>
+#include "../RendererBuffer.h"
+#include "../../Vertex.h"
+
+namespace Duel6 {
+    class NullRenderer;
+
+    class NullBuffer : public RendererBuffer {
+    private:
+        NullRenderer &renderer;
+        const FaceList &faceList;
+        Size vertices;
+        // What a GPU buffer would contain, kept only when the renderer verifies buffers
+        std::vector<Vertex> uploadedVertexes;
+        // First texture and number of animation frames of each face
+        std::vector<std::pair<Uint32, Size>> uploadedTextures;
+
+    public:
+        NullBuffer(NullRenderer &renderer, const FaceList &faceList);
+
+        void update(const FaceList &faceList) override;
+
+        void update(const FaceList &faceList, Size firstFace, Size faceCount) override;
+
+        void render(const Material &material) override;
+
+    private:
+        void copyFaces(Size firstFace, Size faceCount);
+
+        Size countStaleFaces() const;
+    };
+}
+
+#endif
@@ -0,0 +1,232 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "NullRenderer.h"
+#include "NullBuffer.h"
+#include "NullRendererTarget.h"
+#include "../../Format.h"
+
+namespace Duel6 {
+    namespace {
+        const char *getBlendFuncName(BlendFunc func) {
+            switch (func) {
+                case BlendFunc::SrcAlpha:
+                    return "src-alpha";
+                case BlendFunc::SrcColor:
+                    return "src-color";
+                default:
+                    return "none";
+            }
+        }
+    }
+
+    NullRenderer::NullRenderer()
+            : lastTexture(0), boundTexture(0), verifyBuffers(false) {}
+
+    void NullRenderer::resetStats() {
+        stats = Stats();
+    }
+
+    void NullRenderer::setTraceFile(const std::string &path) {
+        trace = path.empty() ? nullptr : std::make_unique<File>(path, File::Mode::Text, File::Access::Write);
+    }
+
+    void NullRenderer::recordBufferUpload(Size vertices) {
+        stats.bufferUploads++;
+        stats.uploadedVertices += vertices;
+        if (trace) {
+            writeTrace(Format("upload {0}") << vertices);
+        }
+    }
+
+    void NullRenderer::recordStaleFaces(Size faces) {
+        stats.staleFaces += faces;
+        if (trace) {
+            writeTrace(Format("stale {0}") << faces);
+        }
+    }
+
+    void NullRenderer::recordBufferDraw(Size vertices, const Material &material) {
+        draw("buffer", vertices, material);
+    }
+
+    Renderer::Info NullRenderer::getInfo() {
+        Info info;
+        info.vendor = "None";
+        info.renderer = "Null renderer";
+        info.version = "0";
+        return info;
+    }
+
+    Renderer::Extensions NullRenderer::getExtensions() {
+        return Extensions();
+    }
+
+    Texture NullRenderer::createTexture(const Image &image, TextureFilter filtering, bool clamp) {
+        stats.texturesCreated++;
+        lastTexture++;
+        if (trace) {
+            writeTrace(Format("texture {0} {1}x{2}x{3}") << lastTexture << image.getWidth() << image.getHeight()
+                                                          << image.getDepth());
+        }
+        return lastTexture;
+    }
+
+    void NullRenderer::freeTexture(Texture textureId) {
+        if (boundTexture == textureId) {
+            boundTexture = 0;
+        }
+    }
+
+    Image NullRenderer::makeScreenshot() {
+        return Image();
+    }
+
+    void NullRenderer::setViewport(Int32 x, Int32 y, Int32 width, Int32 height) {
+        if (trace) {
+            writeTrace(Format("viewport {0} {1} {2} {3}") << x << y << width << height);
+        }
+    }
+
+    void NullRenderer::applyWireframe(bool enable) {
+        if (trace) {
+            writeTrace(Format("wireframe {0}") << (enable ? 1 : 0));
+        }
+    }
+
+    void NullRenderer::applyDepthTest(bool enable) {
+        stats.depthChanges++;
+        if (trace) {
+            writeTrace(Format("depth-test {0}") << (enable ? 1 : 0));
+        }
+    }
+
+    void NullRenderer::applyDepthWrite(bool enable) {
+        stats.depthChanges++;
+        if (trace) {
+            writeTrace(Format("depth-write {0}") << (enable ? 1 : 0));
+        }
+    }
+
+    void NullRenderer::applyBlendFunc(BlendFunc func) {
+        stats.blendChanges++;
+        if (trace) {
+            writeTrace(Format("blend {0}") << getBlendFuncName(func));
+        }
+    }
+
+    void NullRenderer::setGlobalTime(Float32 time) {}
+
+    void NullRenderer::clearBuffers() {
+        if (trace) {
+            writeTrace("clear");
+        }
+    }
+
+    void NullRenderer::point(const Vector &position, Float32 size, const Color &color) {
+        draw("point", 1, color);
+    }
+
+    void NullRenderer::line(const Vector &from, const Vector &to, Float32 width, const Color &color) {
+        draw("line", 2, color);
+    }
+
+    void NullRenderer::triangle(const Vector &p1, const Vector &p2, const Vector &p3, const Color &color) {
+        draw("triangle", 3, color);
+    }
+
+    void NullRenderer::triangle(const Vector &p1, const Vector &t1,
+                                const Vector &p2, const Vector &t2,
+                                const Vector &p3, const Vector &t3,
+                                const Material &material) {
+        draw("triangle", 3, material);
+    }
+
+    void NullRenderer::quad(const Vector &p1, const Vector &p2, const Vector &p3, const Vector &p4,
+                            const Color &color) {
+        draw("quad", 4, color);
+    }
+
+    void NullRenderer::quad(const Vector &p1, const Vector &t1,
+                            const Vector &p2, const Vector &t2,
+                            const Vector &p3, const Vector &t3,
+                            const Vector &p4, const Vector &t4,
+                            const Material &material) {
+        draw("quad", 4, material);
+    }
+
+    std::unique_ptr<RendererBuffer> NullRenderer::makeBuffer(const FaceList &faceList) {
+        stats.buffersCreated++;
+        return std::make_unique<NullBuffer>(*this, faceList);
+    }
+
+    std::unique_ptr<RendererTarget> NullRenderer::makeTarget(ScreenParameters screenParameters) {
+        return std::make_unique<NullRendererTarget>();
+    }
+
+    void NullRenderer::flush() {
+        stats.frames++;
+        if (trace) {
+            writeTrace(Format("frame {0}") << stats.frames);
+        }
+    }
+
+    void NullRenderer::draw(const char *primitive, Size vertices, const Color &color) {
+        stats.drawCalls++;
+        stats.vertices += vertices;
+        if (trace) {
+            writeTrace(Format("{0} {1} color {2} {3} {4} {5}") << primitive << vertices << Int32(color.getRed())
+                                                                << Int32(color.getGreen()) << Int32(color.getBlue())
+                                                                << Int32(color.getAlpha()));
+        }
+    }
+
+    void NullRenderer::draw(const char *primitive, Size vertices, const Material &material) {
+        bindTexture(material.getTexture());
+        stats.drawCalls++;
+        stats.vertices += vertices;
+        if (trace) {
+            writeTrace(Format("{0} {1} texture {2}{3}") << primitive << vertices << material.getTexture()
+                                                         << (material.isMasked() ? " masked" : ""));
+        }
+    }
+
+    void NullRenderer::bindTexture(Texture texture) {
+        if (texture != boundTexture) {
+            boundTexture = texture;
+            stats.textureBinds++;
+            if (trace) {
+                writeTrace(Format("bind {0}") << texture);
+            }
+        }
+    }
+
+    void NullRenderer::writeTrace(const std::string &line) {
+        trace->write(line.data(), 1, line.size());
+        trace->write("\n", 1, 1);
+    }
+}
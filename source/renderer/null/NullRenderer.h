@@ -0,0 +1,152 @@
+/*
+* Copyright (c) 2006, Ondrej Danek (www.ondrej-danek.net)
+* All rights reserved.
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+*     * Redistributions of source code must retain the above copyright
+*       notice, this list of conditions and the following disclaimer.
+*     * Redistributions in binary form must reproduce the above copyright
+*       notice, this list of conditions and the following disclaimer in the
+*       documentation and/or other materials provided with the distribution.
+*     * Neither the name of Ondrej Danek nor the
+*       names of its contributors may be used to endorse or promote products
+*       derived from this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+* GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+* OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef DUEL6_RENDERER_NULL_NULLRENDERER_H
+#define DUEL6_RENDERER_NULL_NULLRENDERER_H
+
+#include <memory>
+#include <string>
+#include "../RendererBase.h"
+#include "../../File.h"
+#include "NullTypes.h"
+
+namespace Duel6 {
+    /** Renderer without any output, counts the issued commands and optionally writes them to a trace file */
+    class NullRenderer
+            : public RendererBase {
+    public:
+        struct Stats {
+            Uint64 frames = 0;
+            Uint64 drawCalls = 0;
+            Uint64 vertices = 0;
+            Uint64 textureBinds = 0;
+            Uint64 blendChanges = 0;
+            Uint64 depthChanges = 0;
+            Uint64 buffersCreated = 0;
+            Uint64 bufferUploads = 0;
+            Uint64 uploadedVertices = 0;
+            Uint64 texturesCreated = 0;
+            // Drawn faces whose uploaded copy differs from the face list, counted only when verifying buffers
+            Uint64 staleFaces = 0;
+        };
+
+    private:
+        Texture lastTexture;
+        Texture boundTexture;
+        Stats stats;
+        std::unique_ptr<File> trace;
+        bool verifyBuffers;
+
+    public:
+        NullRenderer();
+
+        const Stats &getStats() const {
+            return stats;
+        }
+
+        void resetStats();
+
+        /** Writes every command to the given text file, an empty path stops tracing */
+        void setTraceFile(const std::string &path);
+
+        /** Buffers keep a copy of the uploaded faces and compare it with their face list on every draw */
+        void setVerifyBuffers(bool verify) {
+            verifyBuffers = verify;
+        }
+
+        bool isVerifyingBuffers() const {
+            return verifyBuffers;
+        }
+
+        void recordBufferUpload(Size vertices);
+
+        void recordStaleFaces(Size faces);
+
+        void recordBufferDraw(Size vertices, const Material &material);
+
+        Info getInfo() override;
+
+        Extensions getExtensions() override;
+
+        Texture createTexture(const Image &image, TextureFilter filtering, bool clamp) override;
+
+        void freeTexture(Texture textureId) override;
+
+        Image makeScreenshot() override;
+
+        void setViewport(Int32 x, Int32 y, Int32 width, Int32 height) override;
+
+        void setGlobalTime(Float32 time) override;
+
+        void clearBuffers() override;
+
+        void point(const Vector &position, Float32 size, const Color &color) override;
+
+        void line(const Vector &from, const Vector &to, Float32 width, const Color &color) override;
+
+        void triangle(const Vector &p1, const Vector &p2, const Vector &p3, const Color &color) override;
+
+        void triangle(const Vector &p1, const Vector &t1,
+                      const Vector &p2, const Vector &t2,
+                      const Vector &p3, const Vector &t3,
+                      const Material &material) override;
+
+        void quad(const Vector &p1, const Vector &p2, const Vector &p3, const Vector &p4, const Color &color) override;
+
+        void quad(const Vector &p1, const Vector &t1,
+                  const Vector &p2, const Vector &t2,
+                  const Vector &p3, const Vector &t3,
+                  const Vector &p4, const Vector &t4,
+                  const Material &material) override;
+
+        std::unique_ptr<RendererBuffer> makeBuffer(const FaceList &faceList) override;
+
+        std::unique_ptr<RendererTarget> makeTarget(ScreenParameters screenParameters) override;
+
+        void flush() override;
+
+    protected:
+        void applyWireframe(bool enable) override;
+
+        void applyDepthTest(bool enable) override;
+
+        void applyDepthWrite(bool enable) override;
+
+        void applyBlendFunc(BlendFunc func) override;
+
+    private:
+        void draw(const char *primitive, Size vertices, const Color &color);
+
+        void draw(const char *primitive, Size vertices, const Material &material);
+
+        void bindTexture(Texture texture);
+
+        void writeTrace(const std::string &line);
+    };
+}
+
+#endif
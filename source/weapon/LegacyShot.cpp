@@ -30,11 +30,10 @@
 #include "LegacyShot.h"
 
 namespace Duel6 {
-    LegacyShot::LegacyShot(Player &player, World &world, const LegacyWeapon &weapon, Animation shotAnimation,
-                           Animation boomAnimation, Orientation orientation, const Rectangle &collisionRect)
-            : ShotBase(player.getWeapon(), player), textures(weapon.getTextures()),
-              samples(weapon.getSamples()), animationShot(shotAnimation),
-              animationBoom(boomAnimation), collisionRect(collisionRect), orientation(orientation),
+    LegacyShot::LegacyShot(Player &player, World &world, const LegacyWeapon &weapon, const Definition &definition,
+                           Orientation orientation)
+            : ShotBase(player.getWeapon(), player), definition(definition), textures(weapon.getTextures()),
+              samples(weapon.getSamples()), orientation(orientation),
               shotHit({false, nullptr, nullptr}), bulletSpeed(weapon.getShotSpeed(player.getChargeLevel())),
               power(weapon.getShotPower(player.getChargeLevel())) {
         const Vector dim = getDimensions();
@@ -56,10 +55,6 @@ namespace Duel6 {
         sprite->setPosition(getSpritePosition());
     }
 
-    bool LegacyShot::isColliding() const {
-        return false;
-    }
-
     bool LegacyShot::isPowerful() const {
         return powerful;
     }
@@ -72,30 +67,6 @@ namespace Duel6 {
         return power;
     }
 
-    Float32 LegacyShot::getExplosionRange() const {
-        return 0;
-    }
-
-    bool LegacyShot::hasBlood() const {
-        return true;
-    }
-
-    bool LegacyShot::hasPlayerExplosion() const {
-        return false;
-    }
-
-    Color LegacyShot::getPlayerExplosionColor() const {
-        return Color::BLACK;
-    }
-
-    Animation LegacyShot::getShotAnimation() const {
-        return animationShot;
-    }
-
-    Animation LegacyShot::getBoomAnimation() const {
-        return animationBoom;
-    }
-
     bool LegacyShot::update(Float32 elapsedTime, World &world) {
         move(elapsedTime);
 
@@ -177,7 +148,7 @@ namespace Duel6 {
     }
 
     ShotHit LegacyShot::evaluateShotHit(World &world) {
-        ShotHit hit = checkPlayerCollision(world.getPlayers());
+        ShotHit hit = checkPlayerCollision(world.getShotList());
         if (!hit.hit) {
             hit = checkWorldCollision(world.getLevel());
         }
@@ -187,16 +158,16 @@ namespace Duel6 {
         return hit;
     }
 
-    ShotHit LegacyShot::checkPlayerCollision(std::vector<Player> &players) {
+    ShotHit LegacyShot::checkPlayerCollision(ShotList &shotList) {
         const Rectangle shotBox = getCollisionRect();
 
-        for (Player &player : players) {
-            if (!player.isInGame() || player.getBonus() == BonusType::INVISIBILITY || player.is(getPlayer())) {
+        for (Player *player : shotList.findPlayers(shotBox)) {
+            if (!player->isInGame() || player->getBonus() == BonusType::INVISIBILITY || player->is(getPlayer())) {
                 continue;
             }
 
-            if (Collision::rectangles(player.getCollisionRect(), shotBox)) {
-                return {true, &player, nullptr};
+            if (Collision::rectangles(player->getCollisionRect(), shotBox)) {
+                return {true, player, nullptr};
             }
         }
 
@@ -223,14 +194,13 @@ namespace Duel6 {
 
         if (collisionSetting == ShotCollisionSetting::All ||
             (collisionSetting == ShotCollisionSetting::Large && isColliding())) {
-            shotList.forEach([this, &hit](Shot &otherShot) -> bool {
-                if (this != &otherShot && otherShot.requestCollision(*this)) {
+            for (Shot *otherShot : shotList.findShots(getCollisionRect())) {
+                if (this != otherShot && otherShot->requestCollision(*this)) {
                     hit.hit = true;
-                    hit.collidingShotPlayer = &otherShot.getPlayer();
-                    return false;
+                    hit.collidingShotPlayer = &otherShot->getPlayer();
+                    break;
                 }
-                return true;
-            });
+            }
         }
         return hit;
     }
@@ -251,19 +221,29 @@ namespace Duel6 {
         return shotHit;
     }
 
-    SpriteList::Iterator LegacyShot::makeSprite(SpriteList &spriteList) {
+    SpriteList::Handle LegacyShot::makeSprite(SpriteList &spriteList) {
         sprite = spriteList.add(getShotAnimation(), textures.shot);
         sprite->setPosition(getSpritePosition(), 0.6f).setOrientation(this->orientation);
         return sprite;
     }
 
-    SpriteList::Iterator LegacyShot::makeBoomSprite(SpriteList &spriteList) {
+    SpriteList::Handle LegacyShot::makeBoomSprite(SpriteList &spriteList) {
         auto sprite = spriteList.add(getBoomAnimation(), textures.boom);
         sprite->setPosition(getCentre() - Vector(0.5f, 0.5f), 0.6f)
                 .setSpeed(0.5f)
                 .setLooping(AnimationLooping::OnceAndRemove)
                 .setOrientation(orientation)
                 .setAlpha(0.6f);
+
+        if (definition.boomStyle == BoomStyle::Glow) {
+            sprite->setAlpha(1.0f).setBlendFunc(BlendFunc::SrcColor);
+        }
+        if (definition.boomStyle != BoomStyle::Default) {
+            sprite->setNoDepth(true);
+        }
+        if (definition.boomGrow > 0) {
+            sprite->setGrow(definition.boomGrow * getPowerFactor());
+        }
         return sprite;
     }
 }
\ No newline at end of file
@@ -39,24 +39,43 @@
 
 namespace Duel6 {
     class LegacyShot : public ShotBase {
+    public:
+        enum class BoomStyle {
+            Default,
+            NoDepth,
+            Glow
+        };
+
+        /** Constant properties of a shot type, read directly instead of through virtual methods */
+        struct Definition {
+            Rectangle collisionRect;
+            Animation shotAnimation;
+            Animation boomAnimation;
+            bool colliding;
+            bool blood;
+            bool playerExplosion;
+            Color playerExplosionColor;
+            Float32 explosionRange;
+            Float32 boomGrow;
+            BoomStyle boomStyle;
+        };
+
     private:
+        const Definition &definition;
         const LegacyWeapon::WeaponTextures &textures;
         const LegacyWeapon::WeaponSamples &samples;
-        const Animation animationShot;
-        const Animation animationBoom;
-        Rectangle collisionRect;
         Orientation orientation;
         Vector position;
         Vector velocity;
-        SpriteList::Iterator sprite;
+        SpriteList::Handle sprite;
         bool powerful;
         ShotHit shotHit;
         Float32 bulletSpeed;
         Int32 power;
 
     public:
-        LegacyShot(Player &player, World &world, const LegacyWeapon &weapon, Animation shotAnimation,
-                   Animation boomAnimation, Orientation orientation, const Rectangle &collisionRect);
+        LegacyShot(Player &player, World &world, const LegacyWeapon &weapon, const Definition &definition,
+                   Orientation orientation);
 
         bool update(Float32 elapsedTime, World &world) override;
 
@@ -73,7 +92,7 @@ namespace Duel6 {
         ShotHit getShotHit() override;
 
         Vector getDimensions() const override {
-            return collisionRect.getSize();
+            return definition.collisionRect.getSize();
         }
 
         Vector getCentre() const override {
@@ -84,21 +103,33 @@ namespace Duel6 {
             return velocity * bulletSpeed;
         }
 
-        virtual bool isColliding() const;
+        bool isColliding() const {
+            return definition.colliding;
+        }
 
         bool isPowerful() const override;
 
         Float32 getPowerFactor() const;
 
-        virtual bool hasBlood() const;
+        bool hasBlood() const {
+            return definition.blood;
+        }
 
-        virtual bool hasPlayerExplosion() const;
+        bool hasPlayerExplosion() const {
+            return definition.playerExplosion;
+        }
 
-        virtual Color getPlayerExplosionColor() const;
+        const Color &getPlayerExplosionColor() const {
+            return definition.playerExplosionColor;
+        }
 
-        Animation getShotAnimation() const;
+        Animation getShotAnimation() const {
+            return definition.shotAnimation;
+        }
 
-        Animation getBoomAnimation() const;
+        Animation getBoomAnimation() const {
+            return definition.boomAnimation;
+        }
 
     protected:
         virtual void onExplode(const Vector &centre, Float32 range, World &world);
@@ -109,6 +140,7 @@ namespace Duel6 {
 
     protected:
         Vector getSpritePosition() const {
+            const Rectangle &collisionRect = definition.collisionRect;
             if (orientation == Orientation::Left) {
                 return getPosition() - collisionRect.left;
             } else {
@@ -118,13 +150,15 @@ namespace Duel6 {
 
         void move(Float32 elapsedTime);
 
-        virtual Float32 getExplosionRange() const;
+        Float32 getExplosionRange() const {
+            return definition.explosionRange;
+        }
 
         Float32 getExplosionPower() const;
 
         ShotHit evaluateShotHit(World &world);
 
-        ShotHit checkPlayerCollision(std::vector<Player> &players);
+        ShotHit checkPlayerCollision(ShotList &shotList);
 
         ShotHit checkWorldCollision(const Level &level);
 
@@ -136,9 +170,9 @@ namespace Duel6 {
 
         void addPlayerBlood(const Player &player, const Vector &point, World &world);
 
-        SpriteList::Iterator makeSprite(SpriteList &spriteList);
+        SpriteList::Handle makeSprite(SpriteList &spriteList);
 
-        virtual SpriteList::Iterator makeBoomSprite(SpriteList &spriteList);
+        SpriteList::Handle makeBoomSprite(SpriteList &spriteList);
     };
 }
 
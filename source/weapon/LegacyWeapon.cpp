@@ -36,7 +36,7 @@ namespace Duel6 {
     }
 
     LegacyWeapon::LegacyWeapon(Sound &sound, TextureManager &textureManager, const Definition &definition, Size index)
-            : WeaponBase(definition.name, definition.reloadSpeed), definition(definition) {
+            : WeaponBase(definition.name, definition.reloadSpeed), definition(definition), index(index) {
         const std::string wpnPath = Format("{0}{1,3|0}") << D6_TEXTURE_WPN_PATH << index;
         auto filterType = NEAREST_FILTER_BOOM.find(index) != NEAREST_FILTER_BOOM.end() ? TextureFilter::Nearest
                                                                                        : TextureFilter::Linear;
@@ -65,11 +65,11 @@ namespace Duel6 {
     }
 
     void LegacyWeapon::shoot(Player &player, Orientation orientation, World &world) const {
-        world.getShotList().addShot(makeShot(player, world, orientation));
+        makeShot(player, world, orientation);
         samples.shot.play();
     }
 
-    SpriteList::Iterator LegacyWeapon::makeSprite(SpriteList &spriteList) const {
+    SpriteList::Handle LegacyWeapon::makeSprite(SpriteList &spriteList) const {
         auto sprite = spriteList.add(definition.animation, textures.gun);
         sprite->setFrame(6).setLooping(AnimationLooping::OnceAndStop);
         return sprite;
@@ -87,6 +87,10 @@ namespace Duel6 {
         return definition;
     }
 
+    Size LegacyWeapon::getIndex() const {
+        return index;
+    }
+
     const LegacyWeapon::WeaponTextures &LegacyWeapon::getTextures() const {
         return textures;
     }
@@ -31,6 +31,7 @@
 #include <string>
 #include "WeaponBase.h"
 #include "../Shot.h"
+#include "../ShotList.h"
 #include "../SpriteList.h"
 
 namespace Duel6 {
@@ -60,6 +61,7 @@ namespace Duel6 {
 
     protected:
         const Definition &definition;
+        Size index;
         WeaponTextures textures;
         WeaponSamples samples;
 
@@ -72,7 +74,7 @@ namespace Duel6 {
 
         void shoot(Player &player, Orientation orientation, World &world) const override;
 
-        SpriteList::Iterator makeSprite(SpriteList &spriteList) const override;
+        SpriteList::Handle makeSprite(SpriteList &spriteList) const override;
 
         Texture getBonusTexture() const override;
 
@@ -80,6 +82,8 @@ namespace Duel6 {
 
         const Definition &getDefinition() const;
 
+        Size getIndex() const;
+
         const WeaponTextures &getTextures() const;
 
         const WeaponSamples &getSamples() const;
@@ -89,7 +93,7 @@ namespace Duel6 {
         virtual Float32 getBulletSpeed() const = 0;
 
     protected:
-        virtual std::unique_ptr<Shot> makeShot(Player &player, World &world, Orientation orientation) const = 0;
+        virtual ShotHandle makeShot(Player &player, World &world, Orientation orientation) const = 0;
     };
 }
 
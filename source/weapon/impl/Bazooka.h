@@ -38,7 +38,7 @@ namespace Duel6 {
         Float32 getBulletSpeed() const override;
 
     protected:
-        std::unique_ptr<Shot> makeShot(Player &player, World &world, Orientation orientation) const override;
+        ShotHandle makeShot(Player &player, World &world, Orientation orientation) const override;
     };
 }
 
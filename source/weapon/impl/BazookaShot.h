@@ -31,22 +31,9 @@
 #include "../LegacyShot.h"
 
 namespace Duel6 {
-    class BazookaShot : public LegacyShot {
+    class BazookaShot final : public LegacyShot {
     public:
         BazookaShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation shotOrientation);
-
-        bool hasBlood() const override;
-
-        bool hasPlayerExplosion() const override;
-
-        Color getPlayerExplosionColor() const override;
-
-        bool isColliding() const override;
-
-    protected:
-        SpriteList::Iterator makeBoomSprite(SpriteList &spriteList) override;
-
-        Float32 getExplosionRange() const override;
     };
 }
 
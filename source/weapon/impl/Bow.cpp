@@ -27,6 +27,7 @@
 
 #include "Bow.h"
 #include "BowShot.h"
+#include "../../World.h"
 
 namespace Duel6 {
     namespace {
@@ -47,7 +48,7 @@ namespace Duel6 {
         return true;
     }
 
-    std::unique_ptr<Shot> Bow::makeShot(Player &player, World &world, Orientation orientation) const {
-        return std::make_unique<BowShot>(player, world, *this, orientation);
+    ShotHandle Bow::makeShot(Player &player, World &world, Orientation orientation) const {
+        return world.getShotList().addShot<BowShot>(getIndex(), player, world, *this, orientation);
     }
 }
@@ -29,12 +29,14 @@
 
 namespace Duel6 {
     namespace {
-        const Rectangle collistionRectangle = Rectangle::fromCornerAndSize(Vector(0.05f, 0.84f), Vector(0.38f, 0.18f));
         const AnimationEntry shotAnimation[] = {0, 820, -1, 0};
         const AnimationEntry boomAnimation[] = {0, 164, -1, 0};
+        const LegacyShot::Definition DEFINITION = {
+                Rectangle::fromCornerAndSize(Vector(0.05f, 0.84f), Vector(0.38f, 0.18f)), shotAnimation, boomAnimation,
+                false, true, false, Color(0, 0, 0), 0.0f, 0.0f, LegacyShot::BoomStyle::Default};
     }
 
     BowShot::BowShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation orientation)
-            : LegacyShot(player, world, weapon, shotAnimation, boomAnimation, orientation, collistionRectangle) {
+            : LegacyShot(player, world, weapon, DEFINITION, orientation) {
     }
 }
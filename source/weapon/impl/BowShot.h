@@ -31,7 +31,7 @@
 #include "../LegacyShot.h"
 
 namespace Duel6 {
-    class BowShot : public LegacyShot {
+    class BowShot final : public LegacyShot {
     public:
         BowShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation shotOrientation);
     };
@@ -31,20 +31,9 @@
 #include "../LegacyShot.h"
 
 namespace Duel6 {
-    class DoubleLaserShot : public LegacyShot {
+    class DoubleLaserShot final : public LegacyShot {
     public:
         DoubleLaserShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation shotOrientation);
-
-        bool hasPlayerExplosion() const override;
-
-        Color getPlayerExplosionColor() const override;
-
-        bool isColliding() const override;
-
-    protected:
-        SpriteList::Iterator makeBoomSprite(SpriteList &spriteList) override;
-
-        Float32 getExplosionRange() const override;
     };
 }
 
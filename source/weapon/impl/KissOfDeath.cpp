@@ -27,6 +27,7 @@
 
 #include "KissOfDeath.h"
 #include "KissOfDeathShot.h"
+#include "../../World.h"
 
 namespace Duel6 {
     namespace {
@@ -42,7 +43,7 @@ namespace Duel6 {
         return 4.27f;
     }
 
-    std::unique_ptr<Shot> KissOfDeath::makeShot(Player &player, World &world, Orientation orientation) const {
-        return std::make_unique<KissOfDeathShot>(player, world, *this, orientation);
+    ShotHandle KissOfDeath::makeShot(Player &player, World &world, Orientation orientation) const {
+        return world.getShotList().addShot<KissOfDeathShot>(getIndex(), player, world, *this, orientation);
     }
 }
@@ -29,34 +29,14 @@
 
 namespace Duel6 {
     namespace {
-        const Rectangle collistionRectangle = Rectangle::fromCornerAndSize(Vector(0.22f, 0.74f), Vector(0.43f, 0.22f));
         const AnimationEntry shotAnimation[] = {0, 164, 1, 164, 2, 164, 1, 164, -1, 0};
         const AnimationEntry boomAnimation[] = {0, 82, 1, 82, 0, 82, 1, 82, 0, 82, 1, 82, -1, 0};
+        const LegacyShot::Definition DEFINITION = {
+                Rectangle::fromCornerAndSize(Vector(0.22f, 0.74f), Vector(0.43f, 0.22f)), shotAnimation, boomAnimation,
+                true, false, true, Color(255, 0, 255), 0.0f, 0.61f, LegacyShot::BoomStyle::Default};
     }
 
     KissOfDeathShot::KissOfDeathShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation orientation)
-            : LegacyShot(player, world, weapon, shotAnimation, boomAnimation, orientation, collistionRectangle) {
-    }
-
-    bool KissOfDeathShot::isColliding() const {
-        return true;
-    }
-
-    bool KissOfDeathShot::hasBlood() const {
-        return false;
-    }
-
-    bool KissOfDeathShot::hasPlayerExplosion() const {
-        return true;
-    }
-
-    Color KissOfDeathShot::getPlayerExplosionColor() const {
-        return Color::MAGENTA;
-    }
-
-    SpriteList::Iterator KissOfDeathShot::makeBoomSprite(SpriteList &spriteList) {
-        auto sprite = LegacyShot::makeBoomSprite(spriteList);
-        sprite->setGrow(0.61f * getPowerFactor());
-        return sprite;
+            : LegacyShot(player, world, weapon, DEFINITION, orientation) {
     }
 }
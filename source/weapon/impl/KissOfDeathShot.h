@@ -31,20 +31,9 @@
 #include "../LegacyShot.h"
 
 namespace Duel6 {
-    class KissOfDeathShot : public LegacyShot {
+    class KissOfDeathShot final : public LegacyShot {
     public:
         KissOfDeathShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation shotOrientation);
-
-        bool hasBlood() const override;
-
-        bool hasPlayerExplosion() const override;
-
-        Color getPlayerExplosionColor() const override;
-
-        bool isColliding() const override;
-
-    protected:
-        SpriteList::Iterator makeBoomSprite(SpriteList &spriteList) override;
     };
 }
 
@@ -27,6 +27,7 @@
 
 #include "Laser.h"
 #include "LaserShot.h"
+#include "../../World.h"
 
 namespace Duel6 {
     namespace {
@@ -43,7 +44,7 @@ namespace Duel6 {
         return 15.25f;
     }
 
-    std::unique_ptr<Shot> Laser::makeShot(Player &player, World &world, Orientation orientation) const {
-        return std::make_unique<LaserShot>(player, world, *this, orientation);
+    ShotHandle Laser::makeShot(Player &player, World &world, Orientation orientation) const {
+        return world.getShotList().addShot<LaserShot>(getIndex(), player, world, *this, orientation);
     }
 }
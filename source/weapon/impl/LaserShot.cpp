@@ -29,12 +29,14 @@
 
 namespace Duel6 {
     namespace {
-        const Rectangle collistionRectangle = Rectangle::fromCornerAndSize(Vector(0.185f, 0.76f), Vector(0.40f, 0.11f));
         const AnimationEntry shotAnimation[] = {0, 820, -1, 0};
         const AnimationEntry boomAnimation[] = {0, 164, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+        const LegacyShot::Definition DEFINITION = {
+                Rectangle::fromCornerAndSize(Vector(0.185f, 0.76f), Vector(0.40f, 0.11f)), shotAnimation, boomAnimation,
+                false, true, false, Color(0, 0, 0), 0.0f, 0.0f, LegacyShot::BoomStyle::Default};
     }
 
     LaserShot::LaserShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation orientation)
-            : LegacyShot(player, world, weapon, shotAnimation, boomAnimation, orientation, collistionRectangle) {
+            : LegacyShot(player, world, weapon, DEFINITION, orientation) {
     }
 }
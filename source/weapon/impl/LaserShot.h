@@ -31,7 +31,7 @@
 #include "../LegacyShot.h"
 
 namespace Duel6 {
-    class LaserShot : public LegacyShot {
+    class LaserShot final : public LegacyShot {
     public:
         LaserShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation shotOrientation);
     };
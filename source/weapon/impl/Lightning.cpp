@@ -27,6 +27,7 @@
 
 #include "Lightning.h"
 #include "LightningShot.h"
+#include "../../World.h"
 
 namespace Duel6 {
     namespace {
@@ -43,7 +44,7 @@ namespace Duel6 {
         return 12.2f;
     }
 
-    std::unique_ptr<Shot> Lightning::makeShot(Player &player, World &world, Orientation orientation) const {
-        return std::make_unique<LightningShot>(player, world, *this, orientation);
+    ShotHandle Lightning::makeShot(Player &player, World &world, Orientation orientation) const {
+        return world.getShotList().addShot<LightningShot>(getIndex(), player, world, *this, orientation);
     }
 }
@@ -29,24 +29,14 @@
 
 namespace Duel6 {
     namespace {
-        const Rectangle collistionRectangle = Rectangle::fromCornerAndSize(Vector(0.13f, 0.65f), Vector(0.52f, 0.33f));
         const AnimationEntry shotAnimation[] = {0, 164, 1, 164, -1, 0};
         const AnimationEntry boomAnimation[] = {0, 82, 1, 82, 0, 82, 1, 82, 0, 82, 1, 82, -1, 0};
+        const LegacyShot::Definition DEFINITION = {
+                Rectangle::fromCornerAndSize(Vector(0.13f, 0.65f), Vector(0.52f, 0.33f)), shotAnimation, boomAnimation,
+                false, false, true, Color(0, 255, 255), 0.0f, 0.0f, LegacyShot::BoomStyle::Default};
     }
 
     LightningShot::LightningShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation orientation)
-            : LegacyShot(player, world, weapon, shotAnimation, boomAnimation, orientation, collistionRectangle) {
-    }
-
-    bool LightningShot::hasBlood() const {
-        return false;
-    }
-
-    bool LightningShot::hasPlayerExplosion() const {
-        return true;
-    }
-
-    Color LightningShot::getPlayerExplosionColor() const {
-        return Color::CYAN;
+            : LegacyShot(player, world, weapon, DEFINITION, orientation) {
     }
 }
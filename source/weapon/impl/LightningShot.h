@@ -31,15 +31,9 @@
 #include "../LegacyShot.h"
 
 namespace Duel6 {
-    class LightningShot : public LegacyShot {
+    class LightningShot final : public LegacyShot {
     public:
         LightningShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation shotOrientation);
-
-        bool hasBlood() const override;
-
-        bool hasPlayerExplosion() const override;
-
-        Color getPlayerExplosionColor() const override;
     };
 }
 
@@ -31,7 +31,7 @@
 #include "../LegacyShot.h"
 
 namespace Duel6 {
-    class MachineGunShot : public LegacyShot {
+    class MachineGunShot final : public LegacyShot {
     public:
         MachineGunShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation shotOrientation);
     };
@@ -31,7 +31,7 @@
 #include "../LegacyShot.h"
 
 namespace Duel6 {
-    class PistolShot : public LegacyShot {
+    class PistolShot final : public LegacyShot {
     public:
         PistolShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation shotOrientation);
     };
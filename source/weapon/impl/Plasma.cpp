@@ -27,6 +27,7 @@
 
 #include "Plasma.h"
 #include "PlasmaShot.h"
+#include "../../World.h"
 
 namespace Duel6 {
     namespace {
@@ -43,7 +44,7 @@ namespace Duel6 {
         return 12.2f;
     }
 
-    std::unique_ptr<Shot> Plasma::makeShot(Player &player, World &world, Orientation orientation) const {
-        return std::make_unique<PlasmaShot>(player, world, *this, orientation);
+    ShotHandle Plasma::makeShot(Player &player, World &world, Orientation orientation) const {
+        return world.getShotList().addShot<PlasmaShot>(getIndex(), player, world, *this, orientation);
     }
 }
@@ -29,12 +29,14 @@
 
 namespace Duel6 {
     namespace {
-        const Rectangle collistionRectangle = Rectangle::fromCornerAndSize(Vector(0.28f, 0.70f), Vector(0.38f, 0.23f));
         const AnimationEntry shotAnimation[] = {0, 820, -1, 0};
         const AnimationEntry boomAnimation[] = {0, 82, 1, 82, 0, 82, 1, 82, 0, 82, 1, 82, -1, 0};
+        const LegacyShot::Definition DEFINITION = {
+                Rectangle::fromCornerAndSize(Vector(0.28f, 0.70f), Vector(0.38f, 0.23f)), shotAnimation, boomAnimation,
+                false, true, false, Color(0, 0, 0), 0.0f, 0.0f, LegacyShot::BoomStyle::Default};
     }
 
     PlasmaShot::PlasmaShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation orientation)
-            : LegacyShot(player, world, weapon, shotAnimation, boomAnimation, orientation, collistionRectangle) {
+            : LegacyShot(player, world, weapon, DEFINITION, orientation) {
     }
 }
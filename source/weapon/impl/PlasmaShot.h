@@ -31,7 +31,7 @@
 #include "../LegacyShot.h"
 
 namespace Duel6 {
-    class PlasmaShot : public LegacyShot {
+    class PlasmaShot final : public LegacyShot {
     public:
         PlasmaShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation shotOrientation);
     };
@@ -27,6 +27,7 @@
 
 #include "ShitThrowerShot.h"
 #include "ShitThrower.h"
+#include "../../World.h"
 
 namespace Duel6 {
     namespace {
@@ -50,7 +51,7 @@ namespace Duel6 {
         return 5.49f;
     }
 
-    std::unique_ptr<Shot> ShitThrower::makeShot(Player &player, World &world, Orientation orientation) const {
-        return std::make_unique<ShitThrowerShot>(player, world, *this, orientation, *brownSkin);
+    ShotHandle ShitThrower::makeShot(Player &player, World &world, Orientation orientation) const {
+        return world.getShotList().addShot<ShitThrowerShot>(getIndex(), player, world, *this, orientation, *brownSkin);
     }
 }
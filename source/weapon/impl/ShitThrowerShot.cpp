@@ -29,26 +29,16 @@
 
 namespace Duel6 {
     namespace {
-        const Rectangle collistionRectangle = Rectangle::fromCornerAndSize(Vector(0.28f, 0.72f), Vector(0.38f, 0.18f));
         const AnimationEntry shotAnimation[] = {0, 164, 1, 164, 2, 164, 1, 164, -1, 0};
         const AnimationEntry boomAnimation[] = {0, 164, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+        const LegacyShot::Definition DEFINITION = {
+                Rectangle::fromCornerAndSize(Vector(0.28f, 0.72f), Vector(0.38f, 0.18f)), shotAnimation, boomAnimation,
+                true, false, false, Color(0, 0, 0), 2.0f, 2.44f, LegacyShot::BoomStyle::NoDepth};
     }
 
     ShitThrowerShot::ShitThrowerShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation orientation,
                                      PlayerSkin &brownSkin)
-            : LegacyShot(player, world, weapon, shotAnimation, boomAnimation, orientation, collistionRectangle), brownSkin(brownSkin) {
-    }
-
-    bool ShitThrowerShot::isColliding() const {
-        return true;
-    }
-
-    bool ShitThrowerShot::hasBlood() const {
-        return false;
-    }
-
-    Float32 ShitThrowerShot::getExplosionRange() const {
-        return 2.0f;
+            : LegacyShot(player, world, weapon, DEFINITION, orientation), brownSkin(brownSkin) {
     }
 
     void ShitThrowerShot::onExplode(const Vector &centre, Float32 range, World &world) {
@@ -57,10 +47,4 @@ namespace Duel6 {
     void ShitThrowerShot::onHitPlayer(Player &player, bool directHit, const Vector &point, World &world) {
         player.useTemporarySkin(brownSkin);
     }
-
-    SpriteList::Iterator ShitThrowerShot::makeBoomSprite(SpriteList &spriteList) {
-        auto sprite = LegacyShot::makeBoomSprite(spriteList);
-        sprite->setNoDepth(true).setGrow(2.44f * getPowerFactor());
-        return sprite;
-    }
 }
@@ -31,27 +31,18 @@
 #include "../LegacyShot.h"
 
 namespace Duel6 {
-    class ShitThrowerShot : public LegacyShot {
+    class ShitThrowerShot final : public LegacyShot {
     private:
         PlayerSkin &brownSkin;
 
     public:
         ShitThrowerShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation shotOrientation, PlayerSkin &brownSkin);
 
-        bool hasBlood() const override;
-
         void onHitPlayer(Player &player, bool directHit, const Vector &hitPoint, World &world) override;
 
-        bool isColliding() const override;
-
     protected:
         void onExplode(const Vector &centre, Float32 range, World &world) override;
-
-        Float32 getExplosionRange() const override;
-
-        SpriteList::Iterator makeBoomSprite(SpriteList &spriteList) override;
     };
 }
 
-
 #endif
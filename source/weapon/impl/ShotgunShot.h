@@ -31,7 +31,7 @@
 #include "../LegacyShot.h"
 
 namespace Duel6 {
-    class ShotgunShot : public LegacyShot {
+    class ShotgunShot final : public LegacyShot {
     public:
         ShotgunShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation shotOrientation);
     };
@@ -31,7 +31,7 @@
 #include "../LegacyShot.h"
 
 namespace Duel6 {
-    class SlimeShot : public LegacyShot {
+    class SlimeShot final : public LegacyShot {
     public:
         SlimeShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation shotOrientation);
     };
@@ -31,7 +31,7 @@
 #include "../LegacyShot.h"
 
 namespace Duel6 {
-    class SlingShot : public LegacyShot {
+    class SlingShot final : public LegacyShot {
     public:
         SlingShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation shotOrientation);
     };
@@ -27,6 +27,7 @@
 
 #include "Spray.h"
 #include "SprayShot.h"
+#include "../../World.h"
 
 namespace Duel6 {
     namespace {
@@ -43,7 +44,7 @@ namespace Duel6 {
         return 4.88f;
     }
 
-    std::unique_ptr<Shot> Spray::makeShot(Player &player, World &world, Orientation orientation) const {
-        return std::make_unique<SprayShot>(player, world, *this, orientation);
+    ShotHandle Spray::makeShot(Player &player, World &world, Orientation orientation) const {
+        return world.getShotList().addShot<SprayShot>(getIndex(), player, world, *this, orientation);
     }
 }
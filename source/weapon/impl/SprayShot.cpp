@@ -29,16 +29,14 @@
 
 namespace Duel6 {
     namespace {
-        const Rectangle collistionRectangle = Rectangle::fromCornerAndSize(Vector(0.20f, 0.75f), Vector(0.35f, 0.23f));
         const AnimationEntry shotAnimation[] = {0, 82, 1, 82, -1, 0};
         const AnimationEntry boomAnimation[] = {0, 164, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+        const LegacyShot::Definition DEFINITION = {
+                Rectangle::fromCornerAndSize(Vector(0.20f, 0.75f), Vector(0.35f, 0.23f)), shotAnimation, boomAnimation,
+                false, false, false, Color(0, 0, 0), 0.0f, 0.0f, LegacyShot::BoomStyle::Default};
     }
 
     SprayShot::SprayShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation orientation)
-            : LegacyShot(player, world, weapon, shotAnimation, boomAnimation, orientation, collistionRectangle) {
-    }
-
-    bool SprayShot::hasBlood() const {
-        return false;
+            : LegacyShot(player, world, weapon, DEFINITION, orientation) {
     }
 }
@@ -31,11 +31,9 @@
 #include "../LegacyShot.h"
 
 namespace Duel6 {
-    class SprayShot : public LegacyShot {
+    class SprayShot final : public LegacyShot {
     public:
         SprayShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation shotOrientation);
-
-        bool hasBlood() const override;
     };
 }
 
@@ -27,6 +27,7 @@
 
 #include "StopperGun.h"
 #include "StopperGunShot.h"
+#include "../../World.h"
 
 namespace Duel6 {
     namespace {
@@ -43,7 +44,7 @@ namespace Duel6 {
         return 7.93f;
     }
 
-    std::unique_ptr<Shot> StopperGun::makeShot(Player &player, World &world, Orientation orientation) const {
-        return std::make_unique<StopperGunShot>(player, world, *this, orientation);
+    ShotHandle StopperGun::makeShot(Player &player, World &world, Orientation orientation) const {
+        return world.getShotList().addShot<StopperGunShot>(getIndex(), player, world, *this, orientation);
     }
 }
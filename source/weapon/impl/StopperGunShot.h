@@ -31,7 +31,7 @@
 #include "../LegacyShot.h"
 
 namespace Duel6 {
-    class StopperGunShot : public LegacyShot {
+    class StopperGunShot final : public LegacyShot {
     public:
         StopperGunShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation shotOrientation);
     };
@@ -27,6 +27,7 @@
 
 #include "Triton.h"
 #include "TritonShot.h"
+#include "../../World.h"
 
 namespace Duel6 {
     namespace {
@@ -43,7 +44,7 @@ namespace Duel6 {
         return 6.1f;
     }
 
-    std::unique_ptr<Shot> Triton::makeShot(Player &player, World &world, Orientation orientation) const {
-        return std::make_unique<TritonShot>(player, world, *this, orientation);
+    ShotHandle Triton::makeShot(Player &player, World &world, Orientation orientation) const {
+        return world.getShotList().addShot<TritonShot>(getIndex(), player, world, *this, orientation);
     }
 }
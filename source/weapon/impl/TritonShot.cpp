@@ -29,42 +29,17 @@
 
 namespace Duel6 {
     namespace {
-        const Rectangle collistionRectangle = Rectangle::fromCornerAndSize(Vector(0.05f, 0.66f), Vector(0.55f, 0.29f));
         const AnimationEntry shotAnimation[] = {0, 131, 1, 131, 2, 131, 3, 131, 4, 131, 3, 131, 2, 131, 1, 131, -1, 0};
         const AnimationEntry boomAnimation[] = {0, 16, 2, 16, 3, 16, 4, 16, 5, 16, 6, 16, 7, 16, 8, 16, 9, 16, 10, 16, 11, 16, 12,
                                                 16, 13, 16, 14, 16, 15, 16, 16, 16, 17, 16, 18, 16, 19, 16, 20, 16, 21, 16, 22, 16,
                                                 23, 16, 24, 16, 25, 16, 26, 16, 27, 16, 28, 16, 29, 16, 30, 16, 31, 16, 32, 16,
                                                 33, 16, 34, 16, 35, 16, -1, 0};
+        const LegacyShot::Definition DEFINITION = {
+                Rectangle::fromCornerAndSize(Vector(0.05f, 0.66f), Vector(0.55f, 0.29f)), shotAnimation, boomAnimation,
+                true, false, true, Color(255, 255, 0), 4.0f, 4.27f, LegacyShot::BoomStyle::Glow};
     }
 
     TritonShot::TritonShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation orientation)
-            : LegacyShot(player, world, weapon, shotAnimation, boomAnimation, orientation, collistionRectangle) {
-    }
-
-    bool TritonShot::isColliding() const {
-        return true;
-    }
-
-    bool TritonShot::hasBlood() const {
-        return false;
-    }
-
-    bool TritonShot::hasPlayerExplosion() const {
-        return true;
-    }
-
-    Color TritonShot::getPlayerExplosionColor() const {
-        return Color::YELLOW;
-    }
-
-    Float32 TritonShot::getExplosionRange() const {
-        return 4.0f;
-    }
-
-    SpriteList::Iterator TritonShot::makeBoomSprite(SpriteList &spriteList) {
-        auto sprite = LegacyShot::makeBoomSprite(spriteList);
-        sprite->setAlpha(1.0f).setBlendFunc(BlendFunc::SrcColor).setNoDepth(true);
-        sprite->setGrow(4.27f * getPowerFactor());
-        return sprite;
+            : LegacyShot(player, world, weapon, DEFINITION, orientation) {
     }
 }
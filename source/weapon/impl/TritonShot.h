@@ -31,22 +31,9 @@
 #include "../LegacyShot.h"
 
 namespace Duel6 {
-    class TritonShot : public LegacyShot {
+    class TritonShot final : public LegacyShot {
     public:
         TritonShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation shotOrientation);
-
-        bool hasBlood() const override;
-
-        bool hasPlayerExplosion() const override;
-
-        Color getPlayerExplosionColor() const override;
-
-        bool isColliding() const override;
-
-    protected:
-        SpriteList::Iterator makeBoomSprite(SpriteList &spriteList) override;
-
-        Float32 getExplosionRange() const override;
     };
 }
 
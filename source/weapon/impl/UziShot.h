@@ -31,7 +31,7 @@
 #include "../LegacyShot.h"
 
 namespace Duel6 {
-    class UziShot : public LegacyShot {
+    class UziShot final : public LegacyShot {
     public:
         UziShot(Player &player, World &world, const LegacyWeapon &weapon, Orientation shotOrientation);
     };